@@ -0,0 +1,16 @@
+#ifndef _AVR_INTERRUPT_H_
+#define _AVR_INTERRUPT_H_
+
+/************************************************************************/
+/* Host replacement of <avr/interrupt.h>                                */
+/*                                                                      */
+/* An ISR becomes a plain function, called by the simulation when the   */
+/* interrupt would fire                                                 */
+/************************************************************************/
+#define ISR(vector, ...) void vector(void); void vector(void)
+#define ISR_NAKED
+#define reti() return
+#define sei()
+#define cli()
+
+#endif /* _AVR_INTERRUPT_H_ */
@@ -0,0 +1,184 @@
+#ifndef _AVR_IO_H_
+#define _AVR_IO_H_
+
+/************************************************************************/
+/* Host replacement of <avr/io.h> for the ATxmega128A4U                 */
+/*                                                                      */
+/* Peripherals are plain structs in RAM, defined in hwbp_core_stub.c.   */
+/* Only the registers and bit masks used by the application are here.   */
+/************************************************************************/
+#include <stdint.h>
+
+/* Defined by avr-gcc from -mmcu */
+#define __AVR_ATxmega128A4U__
+
+typedef volatile uint8_t register8_t;
+typedef volatile uint16_t register16_t;
+
+/* Peripherals */
+typedef struct { register8_t DIR, DIRSET, DIRCLR, DIRTGL, OUT, OUTSET, OUTCLR, OUTTGL, IN, INTCTRL, INT0MASK, INT1MASK, INTFLAGS, reserved, REMAP, reserved2, PIN0CTRL, PIN1CTRL, PIN2CTRL, PIN3CTRL, PIN4CTRL, PIN5CTRL, PIN6CTRL, PIN7CTRL; } PORT_t;
+typedef struct { register8_t CTRL, INTCTRL, STATUS, DATA; } SPI_t;
+typedef struct { register8_t DATA, STATUS, reserved, CTRLA, CTRLB, CTRLC, BAUDCTRLA, BAUDCTRLB; } USART_t;
+typedef struct { register8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, reserved, INTCTRLA, INTCTRLB, CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, INTFLAGS; register16_t TEMP, CNT, PER, CCA, CCB, CCC, CCD, PERBUF, CCABUF, CCBBUF, CCCBUF, CCDBUF; } TC0_t;
+typedef struct { register8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, reserved, INTCTRLA, INTCTRLB, CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, INTFLAGS; register16_t TEMP, CNT, PER, CCA, CCB, PERBUF, CCABUF, CCBBUF; } TC1_t;
+typedef struct { register8_t CTRLA, CTRLB, ADDRCTRL, TRIGSRC; register16_t TRFCNT; register8_t REPCNT, SRCADDR0, SRCADDR1, SRCADDR2, DESTADDR0, DESTADDR1, DESTADDR2; } DMA_CH_t;
+typedef struct { register8_t CTRL, INTFLAGS, STATUS; register16_t TEMP; DMA_CH_t CH0, CH1, CH2, CH3; } DMA_t;
+typedef struct { register8_t CH0MUX, CH1MUX, CH2MUX, CH3MUX, CH4MUX, CH5MUX, CH6MUX, CH7MUX, CH0CTRL, CH1CTRL, CH2CTRL, CH3CTRL, CH4CTRL, CH5CTRL, CH6CTRL, CH7CTRL, STROBE, DATA; } EVSYS_t;
+typedef struct { register8_t STATUS, INTPRI, CTRL; } PMIC_t;
+typedef struct { register8_t CTRLA; } ADC_t;
+
+/* Instances */
+extern PORT_t PORTA, PORTB, PORTC, PORTD, PORTE, PORTR;
+extern SPI_t SPIC, SPID;
+extern USART_t USARTC0, USARTC1, USARTD0, USARTD1, USARTE0;
+extern TC0_t TCC0, TCD0, TCE0;
+extern TC1_t TCC1, TCD1;
+extern DMA_t DMA;
+extern EVSYS_t EVSYS;
+extern PMIC_t PMIC;
+
+/* Register aliases */
+#define PORTA_OUT PORTA.OUT
+#define PORTA_OUTSET PORTA.OUTSET
+#define PORTA_OUTCLR PORTA.OUTCLR
+#define PORTA_OUTTGL PORTA.OUTTGL
+#define PORTA_IN PORTA.IN
+#define PORTB_OUT PORTB.OUT
+#define PORTB_OUTSET PORTB.OUTSET
+#define PORTB_OUTCLR PORTB.OUTCLR
+#define PORTB_OUTTGL PORTB.OUTTGL
+#define PORTB_IN PORTB.IN
+#define PORTC_OUT PORTC.OUT
+#define PORTD_OUT PORTD.OUT
+#define SPIC_CTRL SPIC.CTRL
+#define SPIC_STATUS SPIC.STATUS
+#define SPIC_DATA SPIC.DATA
+#define SPID_CTRL SPID.CTRL
+#define SPID_STATUS SPID.STATUS
+#define SPID_DATA SPID.DATA
+#define PMIC_CTRL PMIC.CTRL
+
+/* Bit masks and group configurations */
+#define SPI_CLK2X_bm 0x80
+#define SPI_ENABLE_bm 0x40
+#define SPI_DORD_bm 0x20
+#define SPI_MASTER_bm 0x10
+#define SPI_MODE_0_gc (0x00<<2)
+#define SPI_MODE_1_gc (0x01<<2)
+#define SPI_MODE_2_gc (0x02<<2)
+#define SPI_MODE_3_gc (0x03<<2)
+#define SPI_PRESCALER_DIV4_gc (0x00<<0)
+#define SPI_PRESCALER_DIV16_gc (0x01<<0)
+#define SPI_PRESCALER_DIV64_gc (0x02<<0)
+#define SPI_PRESCALER_DIV128_gc (0x03<<0)
+#define SPI_IF_bm 0x80
+#define SPI_IF_bp 7
+#define SPI_INTLVL_LO_gc 0x01
+
+#define PORT_OPC_TOTEM_gc (0x00<<3)
+#define PORT_ISC_BOTHEDGES_gc 0x00
+#define PORT_ISC_INPUT_DISABLE_gc 0x07
+#define PORT_TC0A_bm 0x01
+#define PORT_TC0B_bm 0x02
+#define PORT_TC0C_bm 0x04
+#define PORT_TC0D_bm 0x08
+#define PORT_TC1A_bm 0x10
+#define PORT_TC1B_bm 0x20
+
+#define TC_CLKSEL_OFF_gc 0x00
+#define TC_CLKSEL_DIV1_gc 0x01
+#define TC_CLKSEL_DIV2_gc 0x02
+#define TC_CLKSEL_DIV4_gc 0x03
+#define TC_CLKSEL_DIV8_gc 0x04
+#define TC_CLKSEL_DIV64_gc 0x05
+#define TC_CLKSEL_DIV256_gc 0x06
+#define TC_CLKSEL_DIV1024_gc 0x07
+#define TC_WGMODE_NORMAL_gc 0x00
+#define TC_WGMODE_SS_gc 0x03
+#define TC0_CCAEN_bm 0x10
+#define TC0_CCBEN_bm 0x20
+#define TC1_CCAEN_bm 0x10
+#define TC_EVACT_OFF_gc (0x00<<5)
+#define TC_EVACT_CAPT_gc (0x01<<5)
+#define TC_EVSEL_CH0_gc 0x08
+#define TC_EVSEL_CH1_gc 0x09
+#define TC_EVSEL_CH2_gc 0x0A
+#define TC_OVFINTLVL_LO_gc 0x01
+#define TC_OVFINTLVL_MED_gc 0x02
+#define TC_OVFINTLVL_HI_gc 0x03
+#define TC_CCAINTLVL_OFF_gc 0x00
+#define TC_CCAINTLVL_LO_gc 0x01
+#define TC_CCAINTLVL_MED_gc 0x02
+#define TC_CCAINTLVL_HI_gc 0x03
+#define TC_CCBINTLVL_LO_gc 0x04
+#define TC0_OVFIF_bm 0x01
+#define TC0_CCAIF_bm 0x10
+#define TC0_CCBIF_bm 0x20
+#define TC0_ERRIF_bm 0x02
+#define TC1_OVFIF_bm 0x01
+#define TC1_CCAIF_bm 0x10
+#define TC0_CMPA_bm 0x01
+#define TC_CMD_RESTART_gc (0x02<<2)
+#define TC_CMD_RESET_gc (0x03<<2)
+
+#define DMA_ENABLE_bm 0x80
+#define DMA_RESET_bm 0x40
+#define DMA_DBUFMODE_DISABLED_gc (0x00<<2)
+#define DMA_PRIMODE_RR0123_gc 0x00
+#define DMA_PRIMODE_CH0123_gc 0x03
+#define DMA_CH_ENABLE_bm 0x80
+#define DMA_CH_RESET_bm 0x40
+#define DMA_CH_REPEAT_bm 0x20
+#define DMA_CH_TRFREQ_bm 0x10
+#define DMA_CH_SINGLE_bm 0x04
+#define DMA_CH_BURSTLEN_1BYTE_gc 0x00
+#define DMA_CH_BURSTLEN_2BYTE_gc 0x01
+#define DMA_CH_CHBUSY_bm 0x80
+#define DMA_CH_CHPEND_bm 0x40
+#define DMA_CH_ERRIF_bm 0x20
+#define DMA_CH_TRNIF_bm 0x10
+#define DMA_CH_ERRINTLVL_OFF_gc (0x00<<2)
+#define DMA_CH_TRNINTLVL_OFF_gc 0x00
+#define DMA_CH_TRNINTLVL_LO_gc 0x01
+#define DMA_CH_TRNINTLVL_MED_gc 0x02
+#define DMA_CH_TRNINTLVL_HI_gc 0x03
+#define DMA_CH_SRCRELOAD_NONE_gc (0x00<<6)
+#define DMA_CH_SRCRELOAD_BLOCK_gc (0x01<<6)
+#define DMA_CH_SRCRELOAD_BURST_gc (0x02<<6)
+#define DMA_CH_SRCRELOAD_TRANSACTION_gc (0x03<<6)
+#define DMA_CH_SRCDIR_FIXED_gc (0x00<<4)
+#define DMA_CH_SRCDIR_INC_gc (0x01<<4)
+#define DMA_CH_DESTRELOAD_NONE_gc (0x00<<2)
+#define DMA_CH_DESTRELOAD_BLOCK_gc (0x01<<2)
+#define DMA_CH_DESTRELOAD_BURST_gc (0x02<<2)
+#define DMA_CH_DESTRELOAD_TRANSACTION_gc (0x03<<2)
+#define DMA_CH_DESTDIR_FIXED_gc (0x00<<0)
+#define DMA_CH_DESTDIR_INC_gc (0x01<<0)
+#define DMA_CH_TRIGSRC_OFF_gc 0x00
+#define DMA_CH_TRIGSRC_EVSYS_CH0_gc 0x01
+#define DMA_CH_TRIGSRC_SPIC_gc 0x4A
+#define DMA_CH_TRIGSRC_SPID_gc 0x6A
+#define DMA_CH0TRNIF_bm 0x01
+#define DMA_CH1TRNIF_bm 0x02
+#define DMA_CH2TRNIF_bm 0x04
+#define DMA_CH3TRNIF_bm 0x08
+
+#define EVSYS_CHMUX_OFF_gc 0x00
+#define EVSYS_CHMUX_PORTB_PIN0_gc 0x58
+#define EVSYS_CHMUX_TCD0_CCA_gc 0xD4
+#define EVSYS_CHMUX_TCD0_OVF_gc 0xD0
+#define EVSYS_DIGFILT_1SAMPLE_gc 0x00
+#define EVSYS_DIGFILT_4SAMPLES_gc 0x03
+
+#define PMIC_RREN_bm 0x80
+#define PMIC_LOLVLEN_bm 0x01
+#define PMIC_MEDLVLEN_bm 0x02
+#define PMIC_HILVLEN_bm 0x04
+
+#define bit_is_set(sfr, bit) ((sfr) & (1 << (bit)))
+#define bit_is_clear(sfr, bit) (!((sfr) & (1 << (bit))))
+#define loop_until_bit_is_set(sfr, bit) do { } while (bit_is_clear(sfr, bit))
+#define loop_until_bit_is_clear(sfr, bit) do { } while (bit_is_set(sfr, bit))
+#define _BV(bit) (1 << (bit))
+
+#endif /* _AVR_IO_H_ */
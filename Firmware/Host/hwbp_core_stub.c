@@ -0,0 +1,153 @@
+#include <avr/io.h>
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "hwbp_core_regs.h"
+#include "app_ios_and_regs.h"
+#include "sim.h"
+
+/************************************************************************/
+/* Peripherals                                                          */
+/************************************************************************/
+PORT_t PORTA, PORTB, PORTC, PORTD, PORTE, PORTR;
+SPI_t SPIC, SPID;
+USART_t USARTC0, USARTC1, USARTD0, USARTD1, USARTE0;
+TC0_t TCC0, TCD0, TCE0;
+TC1_t TCC1, TCD1;
+DMA_t DMA;
+EVSYS_t EVSYS;
+PMIC_t PMIC;
+
+/************************************************************************/
+/* CPU library                                                          */
+/************************************************************************/
+void io_pin2in(PORT_t* port, uint8_t pin, uint8_t pull, uint8_t sense) { port->DIR &= ~(1 << pin); }
+void io_pin2out(PORT_t* port, uint8_t pin, uint8_t out, bool input_en) { port->DIR |= (1 << pin); }
+void io_set_int(PORT_t* port, uint8_t int_level, uint8_t int_n, uint8_t mask, bool reset_mask) {}
+
+/************************************************************************/
+/* Harp core                                                            */
+/************************************************************************/
+/* TX ring buffer of hwbp_core_com, the host sends the events at once */
+volatile uint16_t hwbp_uart_head = 0;
+volatile uint16_t hwbp_uart_tail = 0;
+
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+uint64_t sim_time_us = 0;
+FILE * sim_output = 0;
+uint32_t sim_events_sent = 0;
+void (*sim_event_handler)(uint8_t add, uint32_t second, uint16_t usecond) = 0;
+struct CommonBank sim_common_bank;
+uint32_t sim_second_offset = 0;
+
+/* Timestamps are kept in Harp units, with microseconds in steps of 32 us */
+static uint32_t user_second;
+static uint16_t user_usecond;
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND(void) { return sim_time_us / 1000000 + sim_second_offset; }
+uint16_t core_func_read_R_TIMESTAMP_MICRO(void) { return (sim_time_us % 1000000) / 32; }
+
+void core_func_mark_user_timestamp(void)
+{
+   user_second = core_func_read_R_TIMESTAMP_SECOND();
+   user_usecond = core_func_read_R_TIMESTAMP_MICRO();
+}
+
+void core_func_read_user_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+   *seconds = user_second;
+   *useconds = user_usecond;
+}
+
+void core_func_update_user_timestamp(uint32_t seconds, uint16_t useconds)
+{
+   user_second = seconds;
+   user_usecond = useconds;
+}
+
+/* Prints "<seconds>.<us> <address> <values>", after prefix when given */
+void sim_print_register(const char * prefix, uint8_t add, uint32_t second, uint16_t usecond)
+{
+   uint8_t index = add - APP_REGS_ADD_MIN;
+   uint8_t type = app_regs_type[index];
+   uint8_t * content = app_regs_pointer[index];
+
+   if (!sim_output)
+      return;
+
+   if (prefix)
+      fprintf(sim_output, "%s ", prefix);
+
+   fprintf(sim_output, "%u.%06u %u", second, usecond * 32, add);
+
+   for (uint16_t i = 0; i < app_regs_n_elements[index]; i++)
+   {
+      switch (type)
+      {
+         case TYPE_U8:  fprintf(sim_output, " %u", ((uint8_t*)content)[i]); break;
+         case TYPE_I8:  fprintf(sim_output, " %d", ((int8_t*)content)[i]); break;
+         case TYPE_U16: fprintf(sim_output, " %u", ((uint16_t*)content)[i]); break;
+         case TYPE_I16: fprintf(sim_output, " %d", ((int16_t*)content)[i]); break;
+         case TYPE_U32: fprintf(sim_output, " %u", ((uint32_t*)content)[i]); break;
+         case TYPE_I32: fprintf(sim_output, " %d", ((int32_t*)content)[i]); break;
+      }
+   }
+
+   fprintf(sim_output, "\n");
+}
+
+void core_func_send_event(uint8_t add, bool use_core_timestamp)
+{
+   uint32_t second = use_core_timestamp ? core_func_read_R_TIMESTAMP_SECOND() : user_second;
+   uint16_t usecond = use_core_timestamp ? core_func_read_R_TIMESTAMP_MICRO() : user_usecond;
+
+   sim_events_sent++;
+
+   if (sim_event_handler)
+   {
+      sim_event_handler(add, second, usecond);
+      return;
+   }
+
+   sim_print_register(0, add, second, usecond);
+}
+
+/* Runs the same initialization sequence as the core, then returns */
+void core_func_start_core (
+    const uint16_t who_am_i,
+    const uint8_t hwH,
+    const uint8_t hwL,
+    const uint8_t fwH,
+    const uint8_t fwL,
+    const uint8_t assembly,
+    uint8_t *pointer_to_app_regs,
+    const uint16_t app_mem_size_to_save,
+    const uint8_t num_of_app_registers,
+    const uint8_t *device_name,
+	const bool	device_is_able_to_repeat_clock,
+	const bool	device_is_able_to_generate_clock,
+	const uint8_t default_timestamp_offset
+	)
+{
+   sim_common_bank.R_WHO_AM_I = who_am_i;
+   sim_common_bank.R_HW_VERSION_H = hwH;
+   sim_common_bank.R_HW_VERSION_L = hwL;
+   sim_common_bank.R_ASSEMBLY_VERSION = assembly;
+   sim_common_bank.R_CORE_VERSION_H = 1;   // libATxmega128A4U-1.15.a
+   sim_common_bank.R_CORE_VERSION_L = 15;
+   sim_common_bank.R_FW_VERSION_H = fwH;
+   sim_common_bank.R_FW_VERSION_L = fwL;
+   sim_common_bank.R_OPERATION_CTRL = GM_OP_MODE_STANDBY;
+   sim_common_bank.R_CLOCK_CONFIG = (device_is_able_to_repeat_clock ? B_REP_ABLE : 0) | (device_is_able_to_generate_clock ? B_GEN_ABLE : 0);
+   sim_common_bank.R_TIMESTAMP_OFFSET = default_timestamp_offset;
+   snprintf((char*)sim_common_bank.R_DEVICE_NAME, sizeof(sim_common_bank.R_DEVICE_NAME), "%s", device_name);
+
+   core_callback_define_clock_default();
+   core_callback_initialize_hardware();
+   core_callback_reset_registers();
+   core_callback_registers_were_reinitialized();
+   core_callback_device_to_active();
+}
@@ -0,0 +1,428 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+#include "sim.h"
+
+/************************************************************************/
+/* Benchmark of the interrupts of the firmware                          */
+/*                                                                      */
+/* Each scenario configures the device, runs a few thousand samples     */
+/* and reports the time spent in each interrupt (min/median/mean/max).  */
+/* The scenarios run BENCH_RUNS times and the lowest median is kept,    */
+/* so a busy host doesn't look like a change of the firmware. The times */
+/* are host TSC ticks, not AVR cycles, so a baseline only means         */
+/* something when taken on the same machine in the same session, which  */
+/* is what "make bench" does with the build of another commit.          */
+/*                                                                      */
+/* Usage: loadcells_bench [--baseline file] [--save file]               */
+/*                        [--tolerance percent]                         */
+/*   --baseline   fails if a median is above the stored one + tolerance */
+/*   --save       stores the medians of this run as the new baseline    */
+/************************************************************************/
+extern AppRegs app_regs;
+
+void update_offsets (uint8_t load_cell_channel);
+void process_thresholds(int16_t * values);
+
+#define BENCH_SAMPLES 5000
+#define BENCH_RUNS 5
+
+/* Functions measured on their own, besides the interrupts */
+enum
+{
+   BENCH_FUNC_UPDATE_OFFSETS = SIM_N_ISRS,
+   BENCH_FUNC_PROCESS_THRESHOLDS,
+   BENCH_N_STATS
+};
+
+static sim_stats_t stats[BENCH_N_STATS];
+
+typedef struct
+{
+   char scenario[32];
+   char name[32];
+   double median;
+} baseline_t;
+
+static baseline_t results[64];
+static int n_results = 0;
+static int run = 0;
+
+/************************************************************************/
+/* Helpers                                                              */
+/************************************************************************/
+static void write_reg(uint8_t add, const char * format, ...)
+{
+   char values[512];
+   va_list args;
+
+   va_start(args, format);
+   vsnprintf(values, sizeof(values), format, args);
+   va_end(args);
+
+   if (!sim_write_register(add, values))
+   {
+      fprintf(stderr, "write to register %u was rejected\n", add);
+      exit(2);
+   }
+}
+
+/* Same state as after a reset of the application registers */
+static void reset_device(void)
+{
+   write_reg(ADD_REG_START, "0");
+   sim_wait(2000);
+
+   core_callback_reset_registers();
+   core_callback_registers_were_reinitialized();
+
+   sim_set_boards(B_PORT0 | B_PORT1);
+
+   for (uint8_t i = 0; i < SIM_N_ISRS; i++)
+      sim_stats_reset(&sim_isr_stats[i]);
+}
+
+/* Channels around zero, crossing it every few samples */
+static void run_samples(uint32_t n)
+{
+   for (uint32_t s = 0; s < n; s++)
+   {
+      int16_t values[8];
+
+      for (uint8_t i = 0; i < 8; i++)
+         values[i] = (((s + i) / 3) & 1) ? 1000 + s % 7 : -1000 - s % 5;
+
+      sim_set_adc_values(values);
+      sim_run_sample_period();
+   }
+}
+
+static void enable_thresholds(void)
+{
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      write_reg(ADD_REG_DO0_CH + i, "%u", i);
+      write_reg(ADD_REG_DO0_TH_VALUE + i, "0");
+      write_reg(ADD_REG_DO0_TH_UP_MS + i, "1");
+      write_reg(ADD_REG_DO0_TH_DOWN_MS + i, "1");
+   }
+}
+
+static void report(const char * scenario, const char * name, sim_stats_t * s)
+{
+   if (s->count == 0)
+      return;
+
+   double mean = (double)s->total / s->count;
+   double median = sim_stats_median(s);
+   int i;
+
+   for (i = 0; i < n_results; i++)
+      if (!strcmp(results[i].scenario, scenario) && !strcmp(results[i].name, name))
+         break;
+
+   if (i == n_results)
+   {
+      if (n_results == (int)(sizeof(results) / sizeof(results[0])))
+         return;
+
+      snprintf(results[i].scenario, sizeof(results[0].scenario), "%s", scenario);
+      snprintf(results[i].name, sizeof(results[0].name), "%s", name);
+      results[i].median = median;
+      n_results++;
+   }
+   else if (median < results[i].median)
+      results[i].median = median;
+
+   /* The table shows the last run, with the best median of all runs */
+   if (run == BENCH_RUNS - 1)
+      printf("%-24s %-20s %8u %8llu %8.0f %10.1f %10llu\n", scenario, name, s->count,
+             (unsigned long long)s->min, results[i].median, mean, (unsigned long long)s->max);
+}
+
+static void report_isrs(const char * scenario)
+{
+   for (uint8_t i = 0; i < SIM_N_ISRS; i++)
+      report(scenario, sim_isr_stats[i].name, &sim_isr_stats[i]);
+}
+
+/************************************************************************/
+/* Scenarios                                                            */
+/************************************************************************/
+static void scenario_acquisition(void)
+{
+   reset_device();
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS);
+   write_reg(ADD_REG_START, "1");
+   run_samples(BENCH_SAMPLES);
+   report_isrs("acquisition");
+}
+
+static void scenario_thresholds(void)
+{
+   reset_device();
+   enable_thresholds();
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS | B_EVT_DO_OUT);
+   write_reg(ADD_REG_START, "1");
+   run_samples(BENCH_SAMPLES);
+   report_isrs("thresholds");
+}
+
+static void scenario_thresholds_low_latency(void)
+{
+   reset_device();
+   enable_thresholds();
+   write_reg(ADD_REG_THRESHOLDS_MODE, "%u", GM_THRESHOLDS_LOW_LATENCY);
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS | B_EVT_DO_OUT);
+   write_reg(ADD_REG_START, "1");
+   run_samples(BENCH_SAMPLES);
+   report_isrs("thresholds_low_latency");
+}
+
+static void scenario_filter(void)
+{
+   reset_device();
+   enable_thresholds();
+   write_reg(ADD_REG_FILTER_LENGTH, "%u", FILTER_MA_LENGTH_MAX);
+   write_reg(ADD_REG_FILTER_MODE, "%u", GM_FILTER_MOVING_AVERAGE);
+   write_reg(ADD_REG_FILTER_TARGETS, "%u", B_FILTER_THRESHOLDS | B_FILTER_LOAD_CELLS);
+   write_reg(ADD_REG_THRESHOLDS_MODE, "%u", GM_THRESHOLDS_LOW_LATENCY);
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS | B_EVT_DO_OUT);
+   write_reg(ADD_REG_START, "1");
+   run_samples(BENCH_SAMPLES);
+   report_isrs("filter");
+}
+
+static void scenario_virtual_channels(void)
+{
+   reset_device();
+   enable_thresholds();
+   
+   /* Sum of each port and their difference, as with two platforms */
+   write_reg(ADD_REG_VIRTUAL_WEIGHTS, "1 1 1 1 0 0 0 0  0 0 0 0 1 1 1 1  1 1 1 1 -1 -1 -1 -1  0 0 0 0 0 0 0 0");
+   write_reg(ADD_REG_VIRTUAL_SHIFT, "2 2 2 0");
+   
+   for (uint8_t i = 0; i < 8; i++)
+      write_reg(ADD_REG_DO0_CH + i, "%u", GM_VIRTUAL0 + i % 3);
+   
+   write_reg(ADD_REG_THRESHOLDS_MODE, "%u", GM_THRESHOLDS_LOW_LATENCY);
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS | B_EVT_LOAD_CELLS_VIRTUAL | B_EVT_DO_OUT);
+   write_reg(ADD_REG_START, "1");
+   run_samples(BENCH_SAMPLES);
+   report_isrs("virtual_channels");
+}
+
+static void scenario_decimation_batch(void)
+{
+   reset_device();
+   write_reg(ADD_REG_DECIMATION, "%u", GM_DECIMATION_AVG4);
+   write_reg(ADD_REG_BATCH_SIZE, "%u", BATCH_SIZE_MAX);
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS_BATCH);
+   write_reg(ADD_REG_START, "1");
+   run_samples(BENCH_SAMPLES);
+   report_isrs("decimation_batch");
+}
+
+static void scenario_auto_zero(void)
+{
+   reset_device();
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS);
+   write_reg(ADD_REG_START, "1");
+
+   for (int n = 0; n < 20; n++)
+   {
+      write_reg(ADD_REG_AUTO_ZERO, "255");
+      run_samples(250);
+   }
+
+   report_isrs("auto_zero");
+}
+
+static void scenario_di0(void)
+{
+   reset_device();
+   write_reg(ADD_REG_DI0_CONF, "%u", GM_DI0_SYNC);
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_DI0);
+
+   for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+      sim_set_di0(n & 1);
+
+   report("di0", sim_isr_stats[SIM_ISR_DI0].name, &sim_isr_stats[SIM_ISR_DI0]);
+}
+
+static void scenario_di0_capture(void)
+{
+   reset_device();
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_DI0_EDGE);
+
+   for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+      sim_set_di0(n & 1);
+
+   report("di0_capture", sim_isr_stats[SIM_ISR_DI0_CAPTURE].name, &sim_isr_stats[SIM_ISR_DI0_CAPTURE]);
+}
+
+static void scenario_do_schedule(void)
+{
+   char entries[512];
+   int length = 0;
+
+   reset_device();
+
+   /* Toggles DO1 every 100 us while sampling */
+   for (uint8_t i = 0; i < SCHEDULE_MAX_ENTRIES; i++)
+      length += snprintf(entries + length, sizeof(entries) - length, "100 %lu ",
+                         ((unsigned long)SCHEDULE_ACTION_TOGGLE << 16) | (1 << 1));
+
+   write_reg(ADD_REG_DO_SCHEDULE, "%s", entries);
+   write_reg(ADD_REG_DO_SCHEDULE_LENGTH, "%u", SCHEDULE_MAX_ENTRIES);
+   write_reg(ADD_REG_EVNT_ENABLE, "%u", B_EVT_LOAD_CELLS | B_EVT_DO_OUT | B_EVT_DO_SCHEDULE);
+   write_reg(ADD_REG_START, "1");
+
+   while (sim_isr_stats[SIM_ISR_DO_SCHEDULE].count < BENCH_SAMPLES)
+   {
+      write_reg(ADD_REG_DO_SCHEDULE_START, "%u", GM_SCHEDULE_NOW);
+      run_samples(4);
+   }
+
+   report("do_schedule", sim_isr_stats[SIM_ISR_DO_SCHEDULE].name, &sim_isr_stats[SIM_ISR_DO_SCHEDULE]);
+}
+
+static void scenario_functions(void)
+{
+   reset_device();
+   enable_thresholds();
+
+   sim_stats_reset(&stats[BENCH_FUNC_UPDATE_OFFSETS]);
+   sim_stats_reset(&stats[BENCH_FUNC_PROCESS_THRESHOLDS]);
+
+   for (uint32_t n = 0; n < BENCH_SAMPLES; n++)
+   {
+      int16_t values[8];
+
+      for (uint8_t i = 0; i < 8; i++)
+         values[i] = ((n / 3) & 1) ? 100 : -100;
+
+      SIM_MEASURE(&stats[BENCH_FUNC_UPDATE_OFFSETS], update_offsets(n & 7));
+      SIM_MEASURE(&stats[BENCH_FUNC_PROCESS_THRESHOLDS], process_thresholds(values));
+   }
+
+   report("functions", "update_offsets", &stats[BENCH_FUNC_UPDATE_OFFSETS]);
+   report("functions", "process_thresholds", &stats[BENCH_FUNC_PROCESS_THRESHOLDS]);
+}
+
+/************************************************************************/
+/* Baseline                                                             */
+/************************************************************************/
+static int save_baseline(const char * path)
+{
+   FILE * file = fopen(path, "w");
+
+   if (!file)
+   {
+      perror(path);
+      return 1;
+   }
+
+   fprintf(file, "# scenario interrupt median (%s)\n", sim_clock_unit);
+
+   for (int i = 0; i < n_results; i++)
+      fprintf(file, "%s %s %.0f\n", results[i].scenario, results[i].name, results[i].median);
+
+   fclose(file);
+   return 0;
+}
+
+static int compare_baseline(const char * path, double tolerance)
+{
+   FILE * file = fopen(path, "r");
+   char line[256];
+   int regressions = 0;
+
+   if (!file)
+   {
+      perror(path);
+      return 1;
+   }
+
+   while (fgets(line, sizeof(line), file))
+   {
+      baseline_t stored;
+
+      if (line[0] == '#' || sscanf(line, "%31s %31s %lf", stored.scenario, stored.name, &stored.median) != 3)
+         continue;
+
+      for (int i = 0; i < n_results; i++)
+      {
+         if (strcmp(results[i].scenario, stored.scenario) || strcmp(results[i].name, stored.name))
+            continue;
+
+         if (results[i].median > stored.median * (1 + tolerance / 100))
+         {
+            printf("REGRESSION %s %s: %.1f > %.1f + %.0f%%\n",
+                   stored.scenario, stored.name, results[i].median, stored.median, tolerance);
+            regressions++;
+         }
+      }
+   }
+
+   fclose(file);
+
+   if (regressions == 0)
+      printf("No regressions against %s\n", path);
+
+   return regressions ? 1 : 0;
+}
+
+int main(int argc, char * argv[])
+{
+   const char * baseline = 0;
+   const char * save = 0;
+   double tolerance = 25;
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (!strcmp(argv[i], "--baseline") && i + 1 < argc)
+         baseline = argv[++i];
+      else if (!strcmp(argv[i], "--save") && i + 1 < argc)
+         save = argv[++i];
+      else if (!strcmp(argv[i], "--tolerance") && i + 1 < argc)
+         tolerance = atof(argv[++i]);
+      else
+      {
+         fprintf(stderr, "usage: %s [--baseline file] [--save file] [--tolerance percent]\n", argv[0]);
+         return 2;
+      }
+   }
+
+   /* The events are counted but not printed */
+   sim_output = 0;
+   sim_initialize();
+
+   printf("%-24s %-20s %8s %8s %8s %10s %10s   (%s)\n", "scenario", "interrupt", "count", "min", "median", "mean", "max", sim_clock_unit);
+
+   for (run = 0; run < BENCH_RUNS; run++)
+   {
+      scenario_acquisition();
+      scenario_thresholds();
+      scenario_thresholds_low_latency();
+      scenario_filter();
+      scenario_virtual_channels();
+      scenario_decimation_batch();
+      scenario_auto_zero();
+      scenario_di0();
+      scenario_di0_capture();
+      scenario_do_schedule();
+      scenario_functions();
+   }
+
+   if (save && save_baseline(save))
+      return 1;
+
+   if (baseline)
+      return compare_baseline(baseline, tolerance);
+
+   return 0;
+}
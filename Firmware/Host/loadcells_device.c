@@ -0,0 +1,578 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "hwbp_core.h"
+#include "hwbp_core_regs.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "sim.h"
+
+/************************************************************************/
+/* Virtual Load Cells device on a pseudo-terminal                       */
+/*                                                                      */
+/* Speaks the Harp binary protocol on a pty, so Bonsai or any other     */
+/* Harp host can open it as if it was the board. The firmware runs in   */
+/* real time on the host build, fed with synthetic load cell signals    */
+/* (a sine per channel plus gaussian noise) and a square wave on DI0.   */
+/* The thresholds, decimation and outputs are the ones of app.c.        */
+/*                                                                      */
+/* Usage: loadcells_device [options]                                    */
+/*   --link path       also makes the pty available at this path        */
+/*   --rate hz         sample rate used instead of SampleRate (1-8000), */
+/*                     0 follows SampleRate                             */
+/*   --amplitude n     amplitude of the sine on each channel (1000)     */
+/*   --frequency hz    frequency of the sine (0.5)                      */
+/*   --noise n         standard deviation of the noise (8)              */
+/*   --di0 hz          frequency of the square wave on DI0, 0 off (1)   */
+/*   --boards mask     readers plugged, bit 0: Port0, bit 1: Port1 (3)  */
+/*   --seed n          seed of the noise                                */
+/************************************************************************/
+extern AppRegs app_regs;
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+/* Harp message types */
+#define MSG_READ           1
+#define MSG_WRITE          2
+#define MSG_EVENT          3
+#define MSG_ERROR          0x08
+
+#define PORT_DEVICE        255
+
+/************************************************************************/
+/* Options                                                              */
+/************************************************************************/
+static const char * link_path = 0;
+static double amplitude = 1000;
+static double frequency_hz = 0.5;
+static double noise = 8;
+static double di0_hz = 1;
+static uint8_t boards = B_PORT0 | B_PORT1;
+static uint32_t seed = 1;
+
+/************************************************************************/
+/* Pseudo-terminal                                                      */
+/************************************************************************/
+static int pty = -1;
+static volatile sig_atomic_t running = 1;
+static bool host_is_connected = false;
+
+static uint8_t tx_buffer[65536];
+static uint32_t tx_length = 0;
+static uint64_t tx_bytes = 0;
+static uint64_t tx_dropped_messages = 0;
+
+static uint8_t rx_buffer[2 * MAX_PACKET_SIZE];
+static uint32_t rx_length = 0;
+static uint64_t rx_bad_messages = 0;
+
+static void stop(int sig)
+{
+   running = 0;
+}
+
+static int open_pty(void)
+{
+   struct termios settings;
+   int fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+   if (fd < 0 || grantpt(fd) || unlockpt(fd))
+   {
+      perror("posix_openpt");
+      return -1;
+   }
+
+   /* Bytes go through untouched, as on the USB serial port */
+   tcgetattr(fd, &settings);
+   cfmakeraw(&settings);
+   tcsetattr(fd, TCSANOW, &settings);
+
+   if (link_path)
+   {
+      unlink(link_path);
+
+      if (symlink(ptsname(fd), link_path))
+      {
+         perror(link_path);
+         return -1;
+      }
+   }
+
+   return fd;
+}
+
+static void flush_tx(void)
+{
+   while (tx_length)
+   {
+      ssize_t n = write(pty, tx_buffer, tx_length);
+
+      if (n <= 0)
+         return;
+
+      memmove(tx_buffer, tx_buffer + n, tx_length - n);
+      tx_length -= n;
+      tx_bytes += n;
+   }
+}
+
+/* Queues a message, or drops it if the host is not keeping up */
+static void send_message(uint8_t message_type, uint8_t add, uint8_t type, const uint8_t * content, uint16_t n_elements, uint32_t second, uint16_t usecond)
+{
+   uint16_t payload_length = n_elements * (type & MSK_TYPE_LEN);
+   uint16_t length = 4 + 6 + payload_length;   // address, port, type, timestamp, payload and checksum
+   uint8_t checksum = 0;
+
+   if (length > MAX_PACKET_SIZE || tx_length + length + 2 > sizeof(tx_buffer))
+   {
+      tx_dropped_messages++;
+      return;
+   }
+
+   uint8_t * message = tx_buffer + tx_length;
+   message[0] = message_type;
+   message[1] = length;
+   message[2] = add;
+   message[3] = PORT_DEVICE;
+   message[4] = type | MSK_TIMESTAMP_AT_PAYLOAD;
+   memcpy(message + 5, &second, 4);
+   memcpy(message + 9, &usecond, 2);
+   memcpy(message + 11, content, payload_length);
+
+   for (uint16_t i = 0; i < length + 1; i++)
+      checksum += message[i];
+   message[length + 1] = checksum;
+
+   tx_length += length + 2;
+}
+
+/************************************************************************/
+/* Common registers                                                     */
+/************************************************************************/
+typedef struct
+{
+   uint8_t type;
+   uint8_t * pointer;
+   uint16_t n_elements;
+} common_reg_t;
+
+static common_reg_t common_regs[COMMON_BANK_ADD_MAX + 1];
+
+#define COMMON_REG(add, field, reg_type) \
+   common_regs[add] = (common_reg_t){reg_type, (uint8_t*)&sim_common_bank.field, sizeof(sim_common_bank.field) / (reg_type & MSK_TYPE_LEN)}
+
+static void init_common_regs(void)
+{
+   COMMON_REG(ADD_R_WHO_AM_I, R_WHO_AM_I, TYPE_U16);
+   COMMON_REG(ADD_R_HW_VERSION_H, R_HW_VERSION_H, TYPE_U8);
+   COMMON_REG(ADD_R_HW_VERSION_L, R_HW_VERSION_L, TYPE_U8);
+   COMMON_REG(ADD_R_ASSEMBLY_VERSION, R_ASSEMBLY_VERSION, TYPE_U8);
+   COMMON_REG(ADD_R_CORE_VERSION_H, R_CORE_VERSION_H, TYPE_U8);
+   COMMON_REG(ADD_R_CORE_VERSION_L, R_CORE_VERSION_L, TYPE_U8);
+   COMMON_REG(ADD_R_FW_VERSION_H, R_FW_VERSION_H, TYPE_U8);
+   COMMON_REG(ADD_R_FW_VERSION_L, R_FW_VERSION_L, TYPE_U8);
+   COMMON_REG(ADD_R_TIMESTAMP_SECOND, R_TIMESTAMP_SECOND, TYPE_U32);
+   COMMON_REG(ADD_R_TIMESTAMP_MICRO, R_TIMESTAMP_MICRO, TYPE_U16);
+   COMMON_REG(ADD_R_OPERATION_CTRL, R_OPERATION_CTRL, TYPE_U8);
+   COMMON_REG(ADD_R_RESET_DEV, R_RESET_DEV, TYPE_U8);
+   COMMON_REG(ADD_R_DEVICE_NAME, R_DEVICE_NAME, TYPE_U8);
+   COMMON_REG(ADD_R_SERIAL_NUMBER, R_SERIAL_NUMBER, TYPE_U16);
+   COMMON_REG(ADD_R_CONFIG, R_CLOCK_CONFIG, TYPE_U8);
+   COMMON_REG(ADD_R_TIMESTAMP_OFFSET, R_TIMESTAMP_OFFSET, TYPE_U8);
+   COMMON_REG(ADD_R_UID, R_UID, TYPE_U8);
+   COMMON_REG(ADD_R_TAG, R_TAG, TYPE_U8);
+   COMMON_REG(ADD_R_HEARTBEAT, R_HEARTBEAT, TYPE_U16);
+   COMMON_REG(ADD_R_VERSION, R_VERSION, TYPE_U8);
+}
+
+static bool device_is_active(void)
+{
+   return (sim_common_bank.R_OPERATION_CTRL & MSK_OP_MODE) != GM_OP_MODE_STANDBY;
+}
+
+static void refresh_common_regs(void)
+{
+   sim_common_bank.R_TIMESTAMP_SECOND = core_func_read_R_TIMESTAMP_SECOND();
+   sim_common_bank.R_TIMESTAMP_MICRO = core_func_read_R_TIMESTAMP_MICRO();
+   sim_common_bank.R_HEARTBEAT = device_is_active() ? B_IS_ACTIVE : 0;
+}
+
+static void send_common_reg(uint8_t message_type, uint8_t add)
+{
+   refresh_common_regs();
+   send_message(message_type, add, common_regs[add].type, common_regs[add].pointer, common_regs[add].n_elements,
+                sim_common_bank.R_TIMESTAMP_SECOND, sim_common_bank.R_TIMESTAMP_MICRO);
+}
+
+static void send_app_reg(uint8_t message_type, uint8_t add)
+{
+   uint8_t index = add - APP_REGS_ADD_MIN;
+
+   send_message(message_type, add, app_regs_type[index], app_regs_pointer[index], app_regs_n_elements[index],
+                core_func_read_R_TIMESTAMP_SECOND(), core_func_read_R_TIMESTAMP_MICRO());
+}
+
+static void set_operation_mode(uint8_t mode)
+{
+   uint8_t previous = sim_common_bank.R_OPERATION_CTRL & MSK_OP_MODE;
+
+   sim_common_bank.R_OPERATION_CTRL = (sim_common_bank.R_OPERATION_CTRL & ~MSK_OP_MODE) | mode;
+
+   if (previous == mode)
+      return;
+
+   if (mode == GM_OP_MODE_STANDBY)
+      core_callback_device_to_standby();
+   else
+      core_callback_device_to_active();
+}
+
+static void dump_registers(void)
+{
+   for (uint8_t add = 0; add <= COMMON_BANK_ADD_MAX; add++)
+      send_common_reg(MSG_READ, add);
+
+   for (uint16_t add = APP_REGS_ADD_MIN; add <= APP_REGS_ADD_MAX; add++)
+      send_app_reg(MSG_READ, add);
+}
+
+static bool write_common_reg(uint8_t add, uint8_t * content)
+{
+   switch (add)
+   {
+      case ADD_R_TIMESTAMP_SECOND:
+         sim_second_offset += *((uint32_t*)content) - core_func_read_R_TIMESTAMP_SECOND();
+         return true;
+
+      case ADD_R_TIMESTAMP_MICRO:
+         /* The microseconds follow the simulated time */
+         return true;
+
+      case ADD_R_OPERATION_CTRL:
+      {
+         uint8_t reg = *content;
+
+         sim_common_bank.R_OPERATION_CTRL = (reg & ~B_DUMP) | (sim_common_bank.R_OPERATION_CTRL & MSK_OP_MODE);
+         set_operation_mode(reg & MSK_OP_MODE);
+         return true;
+      }
+
+      case ADD_R_RESET_DEV:
+         if (*content & B_RST_DEF)
+         {
+            set_operation_mode(GM_OP_MODE_STANDBY);
+            core_callback_reset_registers();
+            core_callback_registers_were_reinitialized();
+         }
+         return true;
+
+      case ADD_R_DEVICE_NAME:
+      case ADD_R_SERIAL_NUMBER:
+      case ADD_R_TIMESTAMP_OFFSET:
+      case ADD_R_TAG:
+         memcpy(common_regs[add].pointer, content, common_regs[add].n_elements * (common_regs[add].type & MSK_TYPE_LEN));
+         return true;
+
+      default:
+         return false;
+   }
+}
+
+/************************************************************************/
+/* Commands from the host                                               */
+/************************************************************************/
+static void process_command(uint8_t * message)
+{
+   uint8_t message_type = message[0];
+   uint8_t length = message[1];
+   uint8_t add = message[2];
+   uint8_t type = message[4] & ~MSK_TIMESTAMP_AT_PAYLOAD;
+   uint8_t * payload = message + 5 + ((message[4] & MSK_TIMESTAMP_AT_PAYLOAD) ? 6 : 0);
+   int16_t payload_length = length + 1 - (payload - message);
+   uint16_t n_elements = (type & MSK_TYPE_LEN) ? payload_length / (type & MSK_TYPE_LEN) : 0;
+   bool ok = false;
+
+   if (payload_length < 0 || (message_type != MSG_READ && message_type != MSG_WRITE))
+   {
+      rx_bad_messages++;
+      return;
+   }
+
+   if (add <= COMMON_BANK_ADD_MAX)
+   {
+      bool matches = common_regs[add].type == type;
+
+      if (message_type == MSG_READ)
+         ok = matches;
+      else
+         ok = matches && common_regs[add].n_elements == n_elements && write_common_reg(add, payload);
+
+      if (!(sim_common_bank.R_OPERATION_CTRL & B_MUTE_RPL))
+         send_common_reg(message_type | (ok ? 0 : MSG_ERROR), add);
+
+      if (ok && message_type == MSG_WRITE && add == ADD_R_OPERATION_CTRL && (payload[0] & B_DUMP))
+         dump_registers();
+   }
+   else if (add >= APP_REGS_ADD_MIN && add <= APP_REGS_ADD_MAX)
+   {
+      if (message_type == MSG_READ)
+         ok = core_read_app_register(add, type);
+      else
+         ok = core_write_app_register(add, type, payload, n_elements);
+
+      if (!(sim_common_bank.R_OPERATION_CTRL & B_MUTE_RPL))
+         send_app_reg(message_type | (ok ? 0 : MSG_ERROR), add);
+   }
+   else
+   {
+      uint32_t second = core_func_read_R_TIMESTAMP_SECOND();
+      uint16_t usecond = core_func_read_R_TIMESTAMP_MICRO();
+
+      send_message(message_type | MSG_ERROR, add, type, payload, 0, second, usecond);
+   }
+}
+
+/* Splits the received bytes into messages, skipping bytes until the checksum matches */
+static void process_rx(void)
+{
+   while (rx_length >= 2)
+   {
+      uint16_t total = rx_buffer[1] + 2;
+      uint8_t checksum = 0;
+
+      if (rx_buffer[1] < 4)
+      {
+         memmove(rx_buffer, rx_buffer + 1, --rx_length);
+         rx_bad_messages++;
+         continue;
+      }
+
+      if (rx_length < total)
+         return;
+
+      for (uint16_t i = 0; i < total - 1; i++)
+         checksum += rx_buffer[i];
+
+      if (checksum != rx_buffer[total - 1])
+      {
+         memmove(rx_buffer, rx_buffer + 1, --rx_length);
+         rx_bad_messages++;
+         continue;
+      }
+
+      process_command(rx_buffer);
+
+      rx_length -= total;
+      memmove(rx_buffer, rx_buffer + total, rx_length);
+   }
+}
+
+static void read_pty(int timeout_ms)
+{
+   struct pollfd fds = {pty, POLLIN, 0};
+
+   if (poll(&fds, 1, timeout_ms) <= 0)
+      return;
+
+   /* No host has the pty open, the board would be unplugged */
+   if (fds.revents & POLLHUP)
+   {
+      if (host_is_connected)
+      {
+         host_is_connected = false;
+         set_operation_mode(GM_OP_MODE_STANDBY);
+         tx_length = 0;
+         rx_length = 0;
+         fprintf(stderr, "Host disconnected\n");
+      }
+
+      usleep(timeout_ms * 1000);
+      return;
+   }
+
+   ssize_t n = read(pty, rx_buffer + rx_length, sizeof(rx_buffer) - rx_length);
+
+   if (n > 0)
+   {
+      if (!host_is_connected)
+         fprintf(stderr, "Host connected\n");
+
+      host_is_connected = true;
+      rx_length += n;
+      process_rx();
+   }
+}
+
+/************************************************************************/
+/* Events and inputs                                                    */
+/************************************************************************/
+static void send_event(uint8_t add, uint32_t second, uint16_t usecond)
+{
+   uint8_t index = add - APP_REGS_ADD_MIN;
+
+   /* As on the board, only an active device sends events */
+   if (!device_is_active())
+      return;
+
+   send_message(MSG_EVENT, add, app_regs_type[index], app_regs_pointer[index], app_regs_n_elements[index], second, usecond);
+}
+
+/* Gaussian noise with the polar Box-Muller method */
+static double gaussian(void)
+{
+   double u, v, s;
+
+   do
+   {
+      u = 2.0 * rand_r(&seed) / RAND_MAX - 1;
+      v = 2.0 * rand_r(&seed) / RAND_MAX - 1;
+      s = u * u + v * v;
+   } while (s >= 1 || s == 0);
+
+   return u * sqrt(-2 * log(s) / s);
+}
+
+static void update_inputs(void)
+{
+   double t = sim_time_us / 1e6;
+   int16_t values[8];
+
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      double value = amplitude * sin(2 * M_PI * frequency_hz * t + i * M_PI / 4) + noise * gaussian();
+
+      values[i] = (value > 32767) ? 32767 : (value < -32768) ? -32768 : (int16_t)value;
+   }
+
+   sim_set_adc_values(values);
+
+   if (di0_hz > 0)
+      sim_set_di0(fmod(t * di0_hz, 1) < 0.5);
+}
+
+static void new_second(void)
+{
+   if (!device_is_active())
+      return;
+
+   if (sim_common_bank.R_OPERATION_CTRL & B_ALIVE_EN)
+      send_common_reg(MSG_EVENT, ADD_R_TIMESTAMP_SECOND);
+
+   if (sim_common_bank.R_OPERATION_CTRL & B_HEARTBEAT_EN)
+      send_common_reg(MSG_EVENT, ADD_R_HEARTBEAT);
+}
+
+static uint64_t elapsed_us(struct timespec * start)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (uint64_t)(now.tv_sec - start->tv_sec) * 1000000 + (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+/************************************************************************/
+/* Main                                                                 */
+/************************************************************************/
+static int usage(const char * program)
+{
+   fprintf(stderr, "usage: %s [--link path] [--rate hz] [--amplitude n] [--frequency hz] [--noise n] [--di0 hz] [--boards mask] [--seed n]\n", program);
+   return 2;
+}
+
+int main(int argc, char * argv[])
+{
+   for (int i = 1; i < argc; i++)
+   {
+      if (i + 1 >= argc)
+         return usage(argv[0]);
+
+      if (!strcmp(argv[i], "--link"))
+         link_path = argv[++i];
+      else if (!strcmp(argv[i], "--rate"))
+      {
+         /* Checked before it is narrowed to 16 bits */
+         char * end;
+         long rate = strtol(argv[++i], &end, 10);
+
+         if (end == argv[i] || *end || rate < 0 || rate > 8000)
+         {
+            fprintf(stderr, "--rate must be between 1 and 8000 Hz, or 0 to follow SampleRate\n");
+            return usage(argv[0]);
+         }
+
+         sim_sample_rate_hz = rate;
+      }
+      else if (!strcmp(argv[i], "--amplitude"))
+         amplitude = atof(argv[++i]);
+      else if (!strcmp(argv[i], "--frequency"))
+         frequency_hz = atof(argv[++i]);
+      else if (!strcmp(argv[i], "--noise"))
+         noise = atof(argv[++i]);
+      else if (!strcmp(argv[i], "--di0"))
+         di0_hz = atof(argv[++i]);
+      else if (!strcmp(argv[i], "--boards"))
+         boards = strtoul(argv[++i], 0, 0);
+      else if (!strcmp(argv[i], "--seed"))
+         seed = strtoul(argv[++i], 0, 0);
+      else
+         return usage(argv[0]);
+   }
+
+   if ((pty = open_pty()) < 0)
+      return 1;
+
+   signal(SIGINT, stop);
+   signal(SIGTERM, stop);
+
+   sim_event_handler = send_event;
+   sim_initialize();
+   sim_set_boards(boards);
+   init_common_regs();
+
+   printf("LoadCells (WhoAmI %u) on %s\n", sim_common_bank.R_WHO_AM_I, link_path ? link_path : ptsname(pty));
+   fflush(stdout);
+
+   struct timespec start;
+   clock_gettime(CLOCK_MONOTONIC, &start);
+   uint32_t last_second = core_func_read_R_TIMESTAMP_SECOND();
+
+   while (running)
+   {
+      uint64_t now_us = elapsed_us(&start);
+
+      /* Catches up with the wall clock, one sample period at a time */
+      while (sim_time_us < now_us && running)
+      {
+         update_inputs();
+         sim_run_sample_period();
+
+         if (core_func_read_R_TIMESTAMP_SECOND() != last_second)
+         {
+            last_second = core_func_read_R_TIMESTAMP_SECOND();
+            new_second();
+         }
+      }
+
+      flush_tx();
+      read_pty(1);
+      flush_tx();
+   }
+
+   fprintf(stderr, "%llu bytes sent, %llu messages dropped, %llu bad messages received\n",
+           (unsigned long long)tx_bytes, (unsigned long long)tx_dropped_messages, (unsigned long long)rx_bad_messages);
+
+   if (link_path)
+      unlink(link_path);
+
+   return 0;
+}
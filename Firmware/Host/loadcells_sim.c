@@ -0,0 +1,23 @@
+#include <stdio.h>
+#include "sim.h"
+
+/************************************************************************/
+/* Runs a script against the firmware and prints the events             */
+/*                                                                      */
+/* Usage: loadcells_sim [script]   (reads the standard input otherwise) */
+/************************************************************************/
+int main(int argc, char * argv[])
+{
+   FILE * script = stdin;
+
+   if (argc > 1 && !(script = fopen(argv[1], "r")))
+   {
+      perror(argv[1]);
+      return 1;
+   }
+
+   sim_output = stdout;
+   sim_initialize();
+
+   return sim_run_script(script);
+}
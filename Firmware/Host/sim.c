@@ -0,0 +1,444 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "sim.h"
+
+/************************************************************************/
+/* Host simulation of the Load Cells firmware                           */
+/*                                                                      */
+/* The application sources are built unchanged. This file plays the     */
+/* part of the hardware: it advances the Harp time, calls the core      */
+/* callbacks every 500 us, fires the sample timer and DMA interrupts    */
+/* and feeds the ADC bytes given by a script or by the benchmark.       */
+/*                                                                      */
+/* Script commands, one per line ('#' starts a comment):                */
+/*   board <ports>             Readers plugged (bit 0: Port0, 1: Port1) */
+/*   write <address> <values>  Writes a register, as the host would     */
+/*   sample <n> <ch0..ch7>     Converts n samples with these ADC values */
+/*   read <address>            Reads a register, as the host would      */
+/*   wait <us>                 Lets time pass without changing inputs   */
+/*   di0 <level>               Drives DI0 high (1) or low (0)           */
+/*   pot_step <counts>         ADC counts each step of the offset pots  */
+/*                             adds to the channel (0 by default)       */
+/*                                                                      */
+/* Each event is printed as "<seconds>.<us> <address> <values>", the    */
+/* reply to a read as "read <seconds>.<us> <address> <values>" and a    */
+/* rejected write as "error <seconds>.<us> <address> <values>", with    */
+/* the values the register kept                                         */
+/************************************************************************/
+extern AppRegs app_regs;
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern const uint16_t sample_rate_hz[];
+extern uint8_t adc_dma_buffer[];
+
+void TCC0_CCB_vect(void);
+void DMA_CH0_vect(void);
+void DMA_CH2_vect(void);
+void PORTB_INT0_vect(void);
+void TCD1_CCA_vect(void);
+void TCE0_CCA_vect(void);
+
+/* Time the DMA takes to read the 8 bytes of one ADC */
+#define SIM_READOUT_US 40
+
+uint16_t sim_sample_rate_hz = 0;
+int16_t sim_pot_step = 0;
+
+static int16_t adc_values[8];
+static bool sim_is_initialized = false;
+static uint64_t next_core_tick_us = 500;
+static uint64_t next_convst_us = 0;
+static uint32_t core_ticks = 0;
+
+/************************************************************************/
+/* Interrupt statistics                                                 */
+/************************************************************************/
+sim_stats_t sim_isr_stats[SIM_N_ISRS] = {
+   {"TCC0_CCB_vect"},
+   {"DMA_CH0_vect"},
+   {"DMA_CH2_vect"},
+   {"core_callback_t_*"},
+   {"PORTB_INT0_vect"},
+   {"TCD1_CCA_vect"},
+   {"TCE0_CCA_vect"}
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+const char * sim_clock_unit = "host TSC ticks";
+uint64_t sim_clock(void) { return __rdtsc(); }
+#else
+const char * sim_clock_unit = "ns";
+uint64_t sim_clock(void)
+{
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+#endif
+
+void sim_stats_reset(sim_stats_t * stats)
+{
+   stats->count = 0;
+   stats->total = 0;
+   stats->min = UINT64_MAX;
+   stats->max = 0;
+}
+
+void sim_stats_add(sim_stats_t * stats, uint64_t elapsed)
+{
+   stats->count++;
+   stats->total += elapsed;
+   if (elapsed < stats->min) stats->min = elapsed;
+   if (elapsed > stats->max) stats->max = elapsed;
+
+   if (stats->count <= SIM_STATS_MAX_SAMPLES)
+      stats->samples[stats->count - 1] = (elapsed > UINT32_MAX) ? UINT32_MAX : elapsed;
+}
+
+static int compare_samples(const void * a, const void * b)
+{
+   uint32_t x = *(const uint32_t*)a;
+   uint32_t y = *(const uint32_t*)b;
+   return (x > y) - (x < y);
+}
+
+/* Unlike the mean, the median is not moved by the host's own interrupts */
+uint64_t sim_stats_median(sim_stats_t * stats)
+{
+   static uint32_t sorted[SIM_STATS_MAX_SAMPLES];
+   uint32_t n = (stats->count < SIM_STATS_MAX_SAMPLES) ? stats->count : SIM_STATS_MAX_SAMPLES;
+
+   if (n == 0)
+      return 0;
+
+   memcpy(sorted, stats->samples, n * sizeof(uint32_t));
+   qsort(sorted, n, sizeof(uint32_t), compare_samples);
+
+   return sorted[n / 2];
+}
+
+/************************************************************************/
+/* Time                                                                 */
+/************************************************************************/
+static void core_tick(void)
+{
+   core_callback_t_before_exec();
+
+   if (++core_ticks & 1)
+      core_callback_t_500us();
+   else
+      core_callback_t_1ms();
+
+   core_callback_t_after_exec();
+}
+
+/* TCD1 and TCE0 run free from the start, TCD1 compare A fires on each match until time_us */
+static void run_timers_until(uint64_t time_us)
+{
+   while (TCD1.CTRLA != TC_CLKSEL_OFF_gc && (TCD1.INTCTRLB & 0x03))
+   {
+      uint64_t now_ticks = sim_time_us * SAMPLE_TIMER_TICKS_PER_US;
+      uint16_t ticks = TCD1.CCA - (uint16_t)now_ticks;
+      uint64_t match_ticks = now_ticks + (ticks ? ticks : 0x10000);
+      uint64_t match_us = (match_ticks + SAMPLE_TIMER_TICKS_PER_US - 1) / SAMPLE_TIMER_TICKS_PER_US;
+
+      if (match_us > time_us)
+         break;
+
+      sim_time_us = match_us;
+      TCD1.CNT = sim_time_us * SAMPLE_TIMER_TICKS_PER_US;
+      TCE0.CNT = TCD1.CNT;
+      SIM_MEASURE(&sim_isr_stats[SIM_ISR_DO_SCHEDULE], TCD1_CCA_vect());
+   }
+
+   sim_time_us = time_us;
+   TCD1.CNT = sim_time_us * SAMPLE_TIMER_TICKS_PER_US;
+   TCE0.CNT = TCD1.CNT;
+}
+
+static void run_core_until(uint64_t time_us)
+{
+   while (next_core_tick_us <= time_us)
+   {
+      run_timers_until(next_core_tick_us);
+      next_core_tick_us += 500;
+
+      SIM_MEASURE(&sim_isr_stats[SIM_ISR_CORE_TICK], core_tick());
+
+      if (sim_time_us % 1000000 == 0)
+         core_callback_t_new_second();
+   }
+
+   run_timers_until(time_us);
+}
+
+/************************************************************************/
+/* Acquisition                                                          */
+/************************************************************************/
+static void fill_adc_bytes(uint8_t first_channel)
+{
+   for (uint8_t i = first_channel; i < first_channel + 4; i++)
+   {
+      /* The pots follow the offset registers */
+      int32_t value = adc_values[i] + (int32_t)sim_pot_step * (&app_regs.REG_OFFSET_CH0)[i];
+
+      if (value > INT16_MAX) value = INT16_MAX;
+      if (value < INT16_MIN) value = INT16_MIN;
+
+      adc_dma_buffer[i*2] = (uint16_t)value >> 8;
+      adc_dma_buffer[i*2 + 1] = (uint16_t)value & 0xFF;
+   }
+}
+
+/* One period of the sample timer, from CONVST to the next CONVST */
+void sim_run_sample_period(void)
+{
+   uint64_t convst_us = next_convst_us;
+   uint32_t period_us = 1000000UL / (sim_sample_rate_hz ? sim_sample_rate_hz : sample_rate_hz[app_regs.REG_SAMPLE_RATE]);
+   uint32_t readout_delay_us = READOUT_DELAY_TICKS / SAMPLE_TIMER_TICKS_PER_US;
+
+   next_convst_us = convst_us + period_us;
+
+   /* Rates above the board's leave no room for the 350 us conversion */
+   if (readout_delay_us + SIM_READOUT_US >= period_us)
+      readout_delay_us = period_us / 2 - SIM_READOUT_US / 2;
+
+   /* TCC0 compare B, 350 us after CONVST */
+   run_core_until(convst_us + readout_delay_us);
+   TCC0.CNT = readout_delay_us * SAMPLE_TIMER_TICKS_PER_US;
+   SIM_MEASURE(&sim_isr_stats[SIM_ISR_SAMPLE_TIMER], TCC0_CCB_vect());
+
+   /* The DMA reads the ADCs of the ports that were sampled */
+   if ((DMA.CH0.CTRLA | DMA.CH2.CTRLA) & DMA_CH_ENABLE_bm)
+   {
+      run_timers_until(sim_time_us + SIM_READOUT_US);
+      TCC0.CNT += SIM_READOUT_US * SAMPLE_TIMER_TICKS_PER_US;
+
+      fill_adc_bytes(0);
+      fill_adc_bytes(4);
+
+      if (DMA.CH0.CTRLA & DMA_CH_ENABLE_bm)
+      {
+         DMA.CH0.CTRLA &= ~DMA_CH_ENABLE_bm;
+         DMA.CH1.CTRLA &= ~DMA_CH_ENABLE_bm;
+         SIM_MEASURE(&sim_isr_stats[SIM_ISR_DMA_PORT0], DMA_CH0_vect());
+      }
+
+      if (DMA.CH2.CTRLA & DMA_CH_ENABLE_bm)
+      {
+         DMA.CH2.CTRLA &= ~DMA_CH_ENABLE_bm;
+         DMA.CH3.CTRLA &= ~DMA_CH_ENABLE_bm;
+         SIM_MEASURE(&sim_isr_stats[SIM_ISR_DMA_PORT1], DMA_CH2_vect());
+      }
+   }
+
+   run_core_until(next_convst_us);
+}
+
+/************************************************************************/
+/* Inputs                                                               */
+/************************************************************************/
+void sim_set_boards(uint8_t ports)
+{
+   /* The readers pull their !CS line up */
+   PORTC.IN = (ports & B_PORT0) ? (PORTC.IN | (1<<0)) : (PORTC.IN & ~(1<<0));
+   PORTD.IN = (ports & B_PORT1) ? (PORTD.IN | (1<<0)) : (PORTD.IN & ~(1<<0));
+}
+
+void sim_set_adc_values(const int16_t * values)
+{
+   for (uint8_t i = 0; i < 8; i++)
+      adc_values[i] = values[i];
+}
+
+void sim_set_di0(bool level)
+{
+   if (level == (read_DI0 ? true : false))
+      return;
+
+   PORTB.IN = level ? (PORTB.IN | (1<<0)) : (PORTB.IN & ~(1<<0));
+   SIM_MEASURE(&sim_isr_stats[SIM_ISR_DI0], PORTB_INT0_vect());
+
+   /* The edge reaches TCE0 through the event channel 0 */
+   if (EVSYS.CH0MUX == EVSYS_CHMUX_PORTB_PIN0_gc && (TCE0.CTRLB & TC0_CCAEN_bm) && (TCE0.CTRLD & TC_EVACT_CAPT_gc))
+   {
+      TCE0.CCA = TCE0.CNT;
+
+      if (TCE0.INTCTRLB & 0x03)
+         SIM_MEASURE(&sim_isr_stats[SIM_ISR_DI0_CAPTURE], TCE0_CCA_vect());
+   }
+}
+
+void sim_wait(uint32_t us)
+{
+   uint64_t until_us = sim_time_us + us;
+
+   while (next_convst_us <= until_us)
+      sim_run_sample_period();
+}
+
+/* Writes a register as the host would, values are given as text */
+bool sim_write_register(uint8_t add, char * values)
+{
+   if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+      return false;
+
+   uint8_t type = app_regs_type[add - APP_REGS_ADD_MIN];
+   uint8_t content[MAX_PACKET_SIZE];
+   uint16_t n_elements = 0;
+
+   for (char * token = strtok(values, " \t"); token; token = strtok(0, " \t"))
+   {
+      long value = strtol(token, 0, 0);
+
+      if ((n_elements + 1) * (type & MSK_TYPE_LEN) > sizeof(content))
+         return false;
+
+      switch (type & MSK_TYPE_LEN)
+      {
+         case 1: ((uint8_t*)content)[n_elements] = value; break;
+         case 2: ((uint16_t*)content)[n_elements] = value; break;
+         case 4: ((uint32_t*)content)[n_elements] = value; break;
+      }
+
+      n_elements++;
+   }
+
+   return core_write_app_register(add, type, content, n_elements);
+}
+
+/* Reads a register as the host would, the reply is printed on sim_output */
+bool sim_read_register(uint8_t add)
+{
+   if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+      return false;
+
+   if (!core_read_app_register(add, app_regs_type[add - APP_REGS_ADD_MIN]))
+      return false;
+
+   sim_print_register("read", add, core_func_read_R_TIMESTAMP_SECOND(), core_func_read_R_TIMESTAMP_MICRO());
+   return true;
+}
+
+/************************************************************************/
+/* Script                                                               */
+/************************************************************************/
+int sim_run_script(FILE * script)
+{
+   char line[1024];
+   int line_number = 0;
+
+   while (fgets(line, sizeof(line), script))
+   {
+      line_number++;
+
+      char * comment = strchr(line, '#');
+      if (comment) *comment = 0;
+
+      char command[16];
+      int consumed;
+      if (sscanf(line, "%15s%n", command, &consumed) != 1)
+         continue;
+
+      char * arguments = line + consumed;
+
+      if (!strcmp(command, "board"))
+      {
+         unsigned ports = strtoul(arguments, 0, 0);
+
+         sim_set_boards(ports);
+      }
+      else if (!strcmp(command, "write"))
+      {
+         char * end;
+         unsigned add = strtoul(arguments, &end, 0);
+
+         if (!sim_write_register(add, end))
+         {
+            if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+            {
+               fprintf(stderr, "line %d: there is no register %u\n", line_number, add);
+               return 1;
+            }
+
+            /* The host gets an error reply */
+            sim_print_register("error", add, core_func_read_R_TIMESTAMP_SECOND(), core_func_read_R_TIMESTAMP_MICRO());
+         }
+      }
+      else if (!strcmp(command, "read"))
+      {
+         unsigned add = strtoul(arguments, 0, 0);
+
+         if (!sim_read_register(add))
+         {
+            fprintf(stderr, "line %d: there is no register %u\n", line_number, add);
+            return 1;
+         }
+      }
+      else if (!strcmp(command, "sample"))
+      {
+         int values[8] = {0};
+         unsigned n;
+
+         if (sscanf(arguments, "%u %d %d %d %d %d %d %d %d", &n,
+                    &values[0], &values[1], &values[2], &values[3],
+                    &values[4], &values[5], &values[6], &values[7]) < 2)
+         {
+            fprintf(stderr, "line %d: sample needs a count and the channel values\n", line_number);
+            return 1;
+         }
+
+         int16_t adc[8];
+         for (uint8_t i = 0; i < 8; i++)
+            adc[i] = values[i];
+         sim_set_adc_values(adc);
+
+         while (n--)
+            sim_run_sample_period();
+      }
+      else if (!strcmp(command, "wait"))
+      {
+         sim_wait(strtoul(arguments, 0, 0));
+      }
+      else if (!strcmp(command, "di0"))
+      {
+         sim_set_di0(strtoul(arguments, 0, 0) != 0);
+      }
+      else if (!strcmp(command, "pot_step"))
+      {
+         sim_pot_step = strtol(arguments, 0, 0);
+      }
+      else
+      {
+         fprintf(stderr, "line %d: unknown command '%s'\n", line_number, command);
+         return 1;
+      }
+   }
+
+   return 0;
+}
+
+void sim_initialize(void)
+{
+   if (sim_is_initialized)
+      return;
+
+   for (uint8_t i = 0; i < SIM_N_ISRS; i++)
+      sim_stats_reset(&sim_isr_stats[i]);
+
+   /* The SPI transfers used by the pots complete at once */
+   SPIC.STATUS = SPI_IF_bm;
+   SPID.STATUS = SPI_IF_bm;
+
+   hwbp_app_initialize();
+
+   sim_is_initialized = true;
+}
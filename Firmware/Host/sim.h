@@ -0,0 +1,99 @@
+#ifndef _SIM_H_
+#define _SIM_H_
+#include <stdint.h>
+#include <stdio.h>
+
+// Define if not defined
+#ifndef bool
+	#define bool uint8_t
+#endif
+
+
+/************************************************************************/
+/* Host simulation of the Load Cells firmware                           */
+/************************************************************************/
+/* Harp time of the device, in us since power up */
+extern uint64_t sim_time_us;
+
+/* Where the events sent by the application are printed (0 to discard) */
+extern FILE * sim_output;
+
+/* Number of events sent since power up */
+extern uint32_t sim_events_sent;
+
+/* Called for each event instead of printing it, when set */
+extern void (*sim_event_handler)(uint8_t add, uint32_t second, uint16_t usecond);
+
+/* Prints a register on sim_output as its event would be, after prefix when given */
+void sim_print_register(const char * prefix, uint8_t add, uint32_t second, uint16_t usecond);
+
+/* Common registers of the core, as given to core_func_start_core() */
+struct CommonBank;
+extern struct CommonBank sim_common_bank;
+
+/* Added to the seconds of the Harp time, when the host sets the clock */
+extern uint32_t sim_second_offset;
+
+/* Sample rate used instead of REG_SAMPLE_RATE, when not 0 */
+extern uint16_t sim_sample_rate_hz;
+
+/* ADC counts added to a channel by each step of its offset pot */
+extern int16_t sim_pot_step;
+
+void sim_initialize(void);
+void sim_set_boards(uint8_t ports);
+void sim_set_adc_values(const int16_t * values);
+void sim_set_di0(bool level);
+bool sim_write_register(uint8_t add, char * values);
+bool sim_read_register(uint8_t add);
+void sim_run_sample_period(void);
+void sim_wait(uint32_t us);
+int sim_run_script(FILE * script);
+
+
+/************************************************************************/
+/* Time spent in each interrupt                                         */
+/************************************************************************/
+enum
+{
+   SIM_ISR_SAMPLE_TIMER,   // TCC0_CCB_vect
+   SIM_ISR_DMA_PORT0,      // DMA_CH0_vect
+   SIM_ISR_DMA_PORT1,      // DMA_CH2_vect
+   SIM_ISR_CORE_TICK,      // core_callback_t_* every 500 us
+   SIM_ISR_DI0,            // PORTB_INT0_vect
+   SIM_ISR_DO_SCHEDULE,    // TCD1_CCA_vect
+   SIM_ISR_DI0_CAPTURE,    // TCE0_CCA_vect
+   SIM_N_ISRS
+};
+
+#define SIM_STATS_MAX_SAMPLES 16384
+
+typedef struct
+{
+   const char * name;
+   uint32_t count;
+   uint64_t total;         // In sim_clock() units
+   uint64_t min;
+   uint64_t max;
+   uint32_t samples[SIM_STATS_MAX_SAMPLES];  // The first ones, for the median
+} sim_stats_t;
+
+extern sim_stats_t sim_isr_stats[SIM_N_ISRS];
+
+/* Time stamp counter on x86, nanoseconds elsewhere */
+uint64_t sim_clock(void);
+extern const char * sim_clock_unit;
+
+void sim_stats_reset(sim_stats_t * stats);
+void sim_stats_add(sim_stats_t * stats, uint64_t elapsed);
+uint64_t sim_stats_median(sim_stats_t * stats);
+
+#define SIM_MEASURE(stats, call)                      \
+   do {                                               \
+      uint64_t sim_measure_start = sim_clock();       \
+      call;                                           \
+      sim_stats_add(stats, sim_clock() - sim_measure_start); \
+   } while (0)
+
+
+#endif /* _SIM_H_ */
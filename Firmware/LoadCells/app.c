@@ -1,6 +1,7 @@
 #include "hwbp_core.h"
 #include "hwbp_core_regs.h"
 #include "hwbp_core_types.h"
+#include "hwbp_core_com.h"
 
 #include "app.h"
 #include "app_funcs.h"
@@ -27,7 +28,7 @@ void hwbp_app_initialize(void)
     uint8_t hwH = 1;
     uint8_t hwL = 1;
     uint8_t fwH = 1;
-    uint8_t fwL = 2;
+    uint8_t fwL = 3;
     uint8_t ass = 0;
     
    	/* Start core */
@@ -67,59 +68,46 @@ void core_callback_catastrophic_error_detected(void)
 #define _4_CLOCK_CYCLES _2_CLOCK_CYCLES; _2_CLOCK_CYCLES
 #define _8_CLOCK_CYCLES _4_CLOCK_CYCLES; _4_CLOCK_CYCLES
 
-/* With CPU @ 32 MHz this function takes 39.2 us to run */
+/* Each AD5204 takes an 11 bit word (3 bits of address and 8 of data)   */
+/* The words of the daisy chained devices are sent as whole SPI bytes,  */
+/* padded with leading zeros that are shifted out of the chain          */
+/* With SPI @ 4 MHz, two devices take 6 us on the wire, ~8 us in total  */
 void AD5204_set_channel(uint8_t channel,
                         uint8_t * data,
                         uint8_t n_of_devices,
                         SPI_t* spi,
                         PORT_t* cs_port,
-                        uint8_t cs_pin,
-                        PORT_t* spi_port)
+                        uint8_t cs_pin)
 {
-   uint8_t current_spi_ctrl;
-   current_spi_ctrl = spi->CTRL;
-   spi->CTRL = 0;
-      
-   clear_io((*(PORT_t *)cs_port), cs_pin);
-   _8_CLOCK_CYCLES;
+   uint32_t frame = 0;
    
+   /* The word of the last device in the chain goes first */
    for (uint8_t n_dev = 0; n_dev < n_of_devices; n_dev++)
    {
-      for (uint8_t add = 0; add < 3; add++)
-      {
-         if ((channel<<add) & 0x04)
-            set_io((*(PORT_t *)spi_port), 5);
-         else
-            clear_io((*(PORT_t *)spi_port), 5);
-         
-         set_io((*(PORT_t *)spi_port), 7);
-         _8_CLOCK_CYCLES;
-         
-         clear_io((*(PORT_t *)spi_port), 7);
-         _8_CLOCK_CYCLES;
-      }
-      
-      for (uint8_t i = 0; i < 8; i++)
-      {
-         if ((data[n_of_devices-n_dev-1]<<i) & 0x80)
-            set_io((*(PORT_t *)spi_port), 5);
-         else
-            clear_io((*(PORT_t *)spi_port), 5);
-         
-         set_io((*(PORT_t *)spi_port), 7);
-         _8_CLOCK_CYCLES;
-         
-         clear_io((*(PORT_t *)spi_port), 7);
-         _8_CLOCK_CYCLES;
-      }
+      frame = (frame << 11) | ((uint16_t)(channel & 0x07) << 8) | data[n_of_devices-n_dev-1];
    }
    
-   set_io((*(PORT_t *)cs_port), cs_pin);
+   uint8_t n_bytes = (n_of_devices * 11 + 7) / 8;
+   
+   /* The callers run between two readouts, while adc_dma_pending is 0 */
    
-   spi->CTRL = current_spi_ctrl;
+   /* Clear a stale transfer complete flag */
+   spi->STATUS;
+   spi->DATA;
+   
+   clear_io((*(PORT_t *)cs_port), cs_pin);
+   
+   while (n_bytes--)
+   {
+      spi->DATA = (uint8_t)(frame >> (n_bytes * 8));
+      while (!(spi->STATUS & SPI_IF_bm));
+      spi->DATA;
+   }
+   
+   set_io((*(PORT_t *)cs_port), cs_pin);
 }
 
-/* With CPU @ 32 MHz this function takes 82.8 us to run */
+/* With CPU @ 32 MHz this function takes ~16 us to run */
 void update_offsets (uint8_t load_cell_channel)
 {
    if (load_cell_channel == 0 || load_cell_channel == 2)
@@ -137,8 +125,8 @@ void update_offsets (uint8_t load_cell_channel)
       else
          port0_pot_channel2[1] = app_regs.REG_OFFSET_CH2 * -1;
          
-      AD5204_set_channel(4-1, port0_pot_channel4, 2, &SPIC, &PORTC, 1, &PORTC);         
-      AD5204_set_channel(2-1, port0_pot_channel2, 2, &SPIC, &PORTC, 1, &PORTC);
+      AD5204_set_channel(4-1, port0_pot_channel4, 2, &SPIC, &PORTC, 1);         
+      AD5204_set_channel(2-1, port0_pot_channel2, 2, &SPIC, &PORTC, 1);
    }         
    
    if (load_cell_channel == 1 || load_cell_channel == 3)
@@ -156,8 +144,8 @@ void update_offsets (uint8_t load_cell_channel)
       else
          port0_pot_channel1[1] = app_regs.REG_OFFSET_CH3 * -1;
       
-      AD5204_set_channel(3-1, port0_pot_channel3, 2, &SPIC, &PORTC, 1, &PORTC);         
-      AD5204_set_channel(1-1, port0_pot_channel1, 2, &SPIC, &PORTC, 1, &PORTC);
+      AD5204_set_channel(3-1, port0_pot_channel3, 2, &SPIC, &PORTC, 1);         
+      AD5204_set_channel(1-1, port0_pot_channel1, 2, &SPIC, &PORTC, 1);
    }         
       
       
@@ -176,8 +164,8 @@ void update_offsets (uint8_t load_cell_channel)
       else
          port1_pot_channel2[1] = app_regs.REG_OFFSET_CH6 * -1;
       
-      AD5204_set_channel(4-1, port1_pot_channel4, 2, &SPID, &PORTD, 1, &PORTD);
-      AD5204_set_channel(2-1, port1_pot_channel2, 2, &SPID, &PORTD, 1, &PORTD);
+      AD5204_set_channel(4-1, port1_pot_channel4, 2, &SPID, &PORTD, 1);
+      AD5204_set_channel(2-1, port1_pot_channel2, 2, &SPID, &PORTD, 1);
    }      
    
    if (load_cell_channel == 5 || load_cell_channel == 7)
@@ -196,740 +184,1707 @@ void update_offsets (uint8_t load_cell_channel)
       else
          port1_pot_channel1[1] = app_regs.REG_OFFSET_CH7 * -1;
       
-      AD5204_set_channel(3-1, port1_pot_channel3, 2, &SPID, &PORTD, 1, &PORTD);
-      AD5204_set_channel(1-1, port1_pot_channel1, 2, &SPID, &PORTD, 1, &PORTD);   
+      AD5204_set_channel(3-1, port1_pot_channel3, 2, &SPID, &PORTD, 1);
+      AD5204_set_channel(1-1, port1_pot_channel1, 2, &SPID, &PORTD, 1);
    }
 }
 
-
 /************************************************************************/
-/* Initialization Callbacks                                             */
+/* ADC readout through DMA                                              */
 /************************************************************************/
-void core_callback_define_clock_default(void) {}
+/* DMA channels used                                                    */
+/* CH0: SPIC.DATA -> adc_dma_buffer[0..7]   (Port0 received bytes)      */
+/* CH1: adc_dma_dummy -> SPIC.DATA          (Port0 next dummy byte)     */
+/* CH2: SPID.DATA -> adc_dma_buffer[8..15]  (Port1 received bytes)      */
+/* CH3: adc_dma_dummy -> SPID.DATA          (Port1 next dummy byte)     */
+/*                                                                      */
+/* All channels are triggered by the SPI transfer complete flag.        */
+/* With fixed priority, the received byte is always read before the     */
+/* next dummy byte is written.                                          */
+/************************************************************************/
+uint8_t adc_dma_buffer[16];            // Raw bytes as they come from the ADCs (MSB first)
+uint8_t adc_dma_dummy = 0;
+volatile uint8_t adc_dma_pending = 0;  // B_PORT0/B_PORT1: readout of the port on going
 
-void core_callback_initialize_hardware(void)
+void dma_set_channel_addresses(DMA_CH_t* ch, uint16_t source, uint16_t destination)
 {
-	/* Initialize IOs */
-	/* Don't delete this function!!! */
-	init_ios();
-    
-   /* Initialize both SPI with 4MHz */
-   SPID_CTRL = SPI_MASTER_bm | SPI_ENABLE_bm | SPI_MODE_0_gc | SPI_CLK2X_bm | SPI_PRESCALER_DIV16_gc;
-   SPIC_CTRL = SPI_MASTER_bm | SPI_ENABLE_bm | SPI_MODE_0_gc | SPI_CLK2X_bm | SPI_PRESCALER_DIV16_gc;
+   ch->SRCADDR0 = (uint8_t)(source >> 0);
+   ch->SRCADDR1 = (uint8_t)(source >> 8);
+   ch->SRCADDR2 = 0;
+   ch->DESTADDR0 = (uint8_t)(destination >> 0);
+   ch->DESTADDR1 = (uint8_t)(destination >> 8);
+   ch->DESTADDR2 = 0;
 }
 
-void core_callback_reset_registers(void)
+void adc_dma_initialize(void)
 {
-	/* Initialize registers */
-   app_regs.REG_START = 0;
-   
-   app_regs.REG_DO0 = 0;
+   DMA.CTRL = DMA_RESET_bm;
+   DMA.CTRL = DMA_ENABLE_bm | DMA_DBUFMODE_DISABLED_gc | DMA_PRIMODE_CH0123_gc;
+
+   /* Port0 */
+   DMA.CH0.ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_BLOCK_gc | DMA_CH_DESTDIR_INC_gc;
+   DMA.CH0.TRIGSRC = DMA_CH_TRIGSRC_SPIC_gc;
+   dma_set_channel_addresses(&DMA.CH0, (uint16_t)(&SPIC.DATA), (uint16_t)(&adc_dma_buffer[0]));
+   DMA.CH0.CTRLB = DMA_CH_ERRINTLVL_OFF_gc | DMA_CH_TRNINTLVL_LO_gc;
+
+   DMA.CH1.ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+   DMA.CH1.TRIGSRC = DMA_CH_TRIGSRC_SPIC_gc;
+   dma_set_channel_addresses(&DMA.CH1, (uint16_t)(&adc_dma_dummy), (uint16_t)(&SPIC.DATA));
+   DMA.CH1.CTRLB = DMA_CH_ERRINTLVL_OFF_gc | DMA_CH_TRNINTLVL_OFF_gc;
+
+   /* Port1 */
+   DMA.CH2.ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_BLOCK_gc | DMA_CH_DESTDIR_INC_gc;
+   DMA.CH2.TRIGSRC = DMA_CH_TRIGSRC_SPID_gc;
+   dma_set_channel_addresses(&DMA.CH2, (uint16_t)(&SPID.DATA), (uint16_t)(&adc_dma_buffer[8]));
+   DMA.CH2.CTRLB = DMA_CH_ERRINTLVL_OFF_gc | DMA_CH_TRNINTLVL_LO_gc;
+
+   DMA.CH3.ADDRCTRL = DMA_CH_SRCRELOAD_NONE_gc | DMA_CH_SRCDIR_FIXED_gc | DMA_CH_DESTRELOAD_NONE_gc | DMA_CH_DESTDIR_FIXED_gc;
+   DMA.CH3.TRIGSRC = DMA_CH_TRIGSRC_SPID_gc;
+   dma_set_channel_addresses(&DMA.CH3, (uint16_t)(&adc_dma_dummy), (uint16_t)(&SPID.DATA));
+   DMA.CH3.CTRLB = DMA_CH_ERRINTLVL_OFF_gc | DMA_CH_TRNINTLVL_OFF_gc;
+}
+
+/* Must be called with the ADCs' !CS already low */
+void adc_dma_start(uint8_t ports)
+{
+   /* Clear any old SPI transfer complete flag so it doesn't trigger the DMA */
+   SPIC_STATUS;
+   SPIC_DATA;
+   SPID_STATUS;
+   SPID_DATA;
+
+   DMA.CH0.TRFCNT = 8;
+   DMA.CH1.TRFCNT = 7;
+   DMA.CH2.TRFCNT = 8;
+   DMA.CH3.TRFCNT = 7;
+
+   /* Only the enabled ports are clocked */
+   adc_dma_pending = ports & (B_PORT0 | B_PORT1);
+
+   if (ports & B_PORT0)
+   {
+      DMA.CH0.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+      DMA.CH1.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+   }
    
-   app_regs.REG_DI0_CONF = GM_DI0_SYNC;
-   app_regs.REG_DO0_CONF = GM_DO0_DIG;
-   app_regs.REG_DO0_PULSE = 10;
+   if (ports & B_PORT1)
+   {
+      DMA.CH2.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+      DMA.CH3.CTRLA = DMA_CH_ENABLE_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_1BYTE_gc;
+   }
+
+   /* The first byte is written by the CPU, the remaining ones by the DMA */
+   if (ports & B_PORT0) SPIC_DATA = 0;
+   if (ports & B_PORT1) SPID_DATA = 0;
+}
+
+
+/************************************************************************/
+/* Sample rate                                                          */
+/************************************************************************/
+/* TCC0 and TCD0 run at 4 MHz (0.25 us) with the same period              */
+/* Their compare A outputs are remapped to PC4 and PD4 (CONVST0/CONVST1), */
+/* so each conversion starts on the timer's BOTTOM without CPU jitter      */
+/* TCC0 compare B starts the readout after the 350 us of conversion        */
+/* Each conversion takes 350 us plus ~40 us to read, so 2 KHz is the maximum */
+const uint16_t sample_rate_hz[] = {100, 200, 250, 500, 1000, 2000};
+
+void update_threshold_durations(void);
+void update_deadband_heartbeat(void);
+
+extern uint8_t sampled_ports;
+
+void update_sample_rate(void)
+{
+   uint16_t period = (1000000UL * SAMPLE_TIMER_TICKS_PER_US) / sample_rate_hz[app_regs.REG_SAMPLE_RATE];
    
-   app_regs.REG_DO_SET = 0;
-   app_regs.REG_DO_CLEAR = 0;
-   app_regs.REG_DO_CLEAR = 0;
-   app_regs.REG_DO_OUT = 0;
+   TCC0.CTRLA = TC_CLKSEL_OFF_gc;
+   TCD0.CTRLA = TC_CLKSEL_OFF_gc;
+   TCC0.CTRLFSET = TC_CMD_RESET_gc;
+   TCD0.CTRLFSET = TC_CMD_RESET_gc;
    
-   app_regs.REG_LOAD_CELLS[0] = 0;
-   app_regs.REG_LOAD_CELLS[1] = 0;
-   app_regs.REG_LOAD_CELLS[2] = 0;
-   app_regs.REG_LOAD_CELLS[3] = 0;
-   app_regs.REG_LOAD_CELLS[4] = 0;
-   app_regs.REG_LOAD_CELLS[5] = 0;
-   app_regs.REG_LOAD_CELLS[6] = 0;
-   app_regs.REG_LOAD_CELLS[7] = 0;
+   /* No CONVST fires in the period being started, so the first TCC0_CCB_vect reads nothing out */
+   sampled_ports = 0;
    
-   app_regs.REG_DO0_CH = GM_SOFTWARE;
-   app_regs.REG_DO1_CH = GM_SOFTWARE;
-   app_regs.REG_DO2_CH = GM_SOFTWARE;
-   app_regs.REG_DO3_CH = GM_SOFTWARE;
-   app_regs.REG_DO4_CH = GM_SOFTWARE;
-   app_regs.REG_DO5_CH = GM_SOFTWARE;
-   app_regs.REG_DO6_CH = GM_SOFTWARE;
-   app_regs.REG_DO7_CH = GM_SOFTWARE;
-   app_regs.REG_DO0_TH_VALUE = 0;
-   app_regs.REG_DO1_TH_VALUE = 0;
-   app_regs.REG_DO2_TH_VALUE = 0;
-   app_regs.REG_DO3_TH_VALUE = 0;
-   app_regs.REG_DO4_TH_VALUE = 0;
-   app_regs.REG_DO5_TH_VALUE = 0;
-   app_regs.REG_DO5_TH_VALUE = 0;
-   app_regs.REG_DO6_TH_VALUE = 0;
-   app_regs.REG_DO7_TH_VALUE = 0;
-   app_regs.REG_DO0_TH_UP_MS = 0;
-   app_regs.REG_DO1_TH_UP_MS = 0;
-   app_regs.REG_DO2_TH_UP_MS = 0;
-   app_regs.REG_DO3_TH_UP_MS = 0;
-   app_regs.REG_DO4_TH_UP_MS = 0;
-   app_regs.REG_DO5_TH_UP_MS = 0;
-   app_regs.REG_DO6_TH_UP_MS = 0;
-   app_regs.REG_DO7_TH_UP_MS = 0;
-   app_regs.REG_DO0_TH_DOWN_MS = 0;
-   app_regs.REG_DO1_TH_DOWN_MS = 0;
-   app_regs.REG_DO2_TH_DOWN_MS = 0;
-   app_regs.REG_DO3_TH_DOWN_MS = 0;
-   app_regs.REG_DO4_TH_DOWN_MS = 0;
-   app_regs.REG_DO5_TH_DOWN_MS = 0;
-   app_regs.REG_DO6_TH_DOWN_MS = 0;
-   app_regs.REG_DO7_TH_DOWN_MS = 0;
+   /* The CONVST outputs are only enabled on TCC0_CCB_vect for the ports to be sampled */
+   TCC0.CTRLB = TC_WGMODE_SS_gc;
+   TCD0.CTRLB = TC_WGMODE_SS_gc;
+   TCC0.PER = period - 1;
+   TCD0.PER = period - 1;
+   TCC0.CCA = CONVST_PULSE_TICKS;
+   TCD0.CCA = CONVST_PULSE_TICKS;
+   TCC0.CCB = READOUT_DELAY_TICKS;
+   TCC0.INTCTRLB = TC_CCBINTLVL_LO_gc;
    
-   app_regs.REG_OFFSET_CH0 = 0;
-   app_regs.REG_OFFSET_CH1 = 0;
-   app_regs.REG_OFFSET_CH2 = 0;
-   app_regs.REG_OFFSET_CH3 = 0;
-   app_regs.REG_OFFSET_CH4 = 0;
-   app_regs.REG_OFFSET_CH5 = 0;
-   app_regs.REG_OFFSET_CH6 = 0;
-   app_regs.REG_OFFSET_CH7 = 0;   
+   /* Started one after the other, both timers are less than one tick apart */
+   TCD0.CTRLA = TC_CLKSEL_DIV8_gc;
+   TCC0.CTRLA = TC_CLKSEL_DIV8_gc;
    
-	app_regs.REG_EVNT_ENABLE = B_EVT_LOAD_CELLS | B_EVT_DI0 | B_EVT_DO0 | B_EVT_DO_OUT;
+   /* The thresholds' time windows are given in ms but counted in samples */
+   update_threshold_durations();
+   update_deadband_heartbeat();
 }
 
-void core_callback_registers_were_reinitialized(void)
-{   
-   /* Update outputs with the saved state */
-   app_write_REG_DO_OUT(&app_regs.REG_DO_OUT);
-}
 
 /************************************************************************/
-/* Callbacks: Visualization                                             */
+/* Decimation                                                           */
 /************************************************************************/
-void core_callback_visualen_to_on(void)
-{
-	/* Update channels enable indicators */
-	//update_enabled_pwmx();
-}
+/* Sums of the samples of the current window, 2^REG_DECIMATION samples long */
+int32_t decimation_accumulator[8];
+uint8_t decimation_counter = 0;
 
-void core_callback_visualen_to_off(void)
+void reset_decimation(void)
 {
-	/* Clear all the enabled indicators */
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      decimation_accumulator[i] = 0;
+   }
+   
+   decimation_counter = 0;
 }
 
-/************************************************************************/
-/* Callbacks: Change on the operation mode                              */
-/************************************************************************/
-void core_callback_device_to_standby(void) {}
-void core_callback_device_to_active(void) {}
-void core_callback_device_to_enchanced_active(void) {}
-void core_callback_device_to_speed(void) {}
 
 /************************************************************************/
-/* Callbacks: 1 ms timer                                                */
+/* Filter                                                               */
 /************************************************************************/
-bool port0_is_plugged = false;
-bool port1_is_plugged = false;
-
-uint8_t update_pots_port0_counter = 0;
-uint8_t update_pots_port1_counter = 0;
-
-uint16_t second_counter = 0;
-
-uint16_t pulse_counter_ms = 0;
+/* Runs on every sample, before the decimation and the thresholds       */
+/* IIR: y += (x - y) / 2^REG_FILTER_LENGTH, kept with 8 fractional bits */
+/* Moving average: running sum of the last 2^REG_FILTER_LENGTH samples  */
+#define FILTER_FRACTION_BITS 8
 
-void update_pots_on_port0(void)
-{
-     if (update_pots_port0_counter)
-     {
-        update_pots_port0_counter--;
-        
-        if (update_pots_port0_counter == 0) update_offsets(0);
-        if (update_pots_port0_counter == 1) update_offsets(1);
-        if (update_pots_port0_counter == 2) update_offsets(2);
-        if (update_pots_port0_counter == 3) update_offsets(3);
-     }
-}
+int16_t filter_output[8];              // Filtered sample, the channels not filtered are copied
+int32_t filter_state[8];               // IIR output << FILTER_FRACTION_BITS, or the moving sum
+int16_t filter_history[8][1 << FILTER_MA_LENGTH_MAX];
+uint8_t filter_index = 0;
+bool filter_is_primed = false;
 
-void update_pots_on_port1(void)
+void reset_filter(void)
 {
-     if (update_pots_port1_counter)
-     { 
-        update_pots_port1_counter--;
-        
-        if (update_pots_port1_counter == 0) update_offsets(4);
-        if (update_pots_port1_counter == 1) update_offsets(5);
-        if (update_pots_port1_counter == 2) update_offsets(6);
-        if (update_pots_port1_counter == 3) update_offsets(7);
-     }
+   filter_is_primed = false;
+   filter_index = 0;
 }
 
-void core_callback_t_before_exec(void)
+void process_filter(int16_t * sample)
 {
-   if (++second_counter == 2000)
+   uint8_t length = app_regs.REG_FILTER_LENGTH;
+   bool is_iir = (app_regs.REG_FILTER_MODE == GM_FILTER_IIR);
+   
+   /* Start from the first sample instead of ramping up from zero */
+   if (!filter_is_primed)
    {
-      if (app_regs.REG_START)
+      for (uint8_t i = 0; i < 8; i++)
       {
-         if (app_regs.REG_DO0_CONF == GM_DO0_TGL_EACH_SEC)
+         if (is_iir)
          {
-            app_read_REG_DO0();
-            app_regs.REG_DO0 ^= 1;
-            app_write_REG_DO0(&app_regs.REG_DO0);
-                
-            if (app_regs.REG_EVNT_ENABLE & B_EVT_DO0)
+            filter_state[i] = (int32_t)sample[i] << FILTER_FRACTION_BITS;
+         }
+         else
+         {
+            filter_state[i] = (int32_t)sample[i] << length;
+            
+            for (uint8_t j = 0; j < (1 << length); j++)
             {
-               core_func_send_event(ADD_REG_DO0, true);
+               filter_history[i][j] = sample[i];
             }
          }
       }
+      
+      filter_is_primed = true;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (!(app_regs.REG_FILTER_CHANNELS & (1<<i)))
+      {
+         filter_output[i] = sample[i];
+         continue;
+      }
+      
+      if (is_iir)
+      {
+         filter_state[i] += (((int32_t)sample[i] << FILTER_FRACTION_BITS) - filter_state[i]) >> length;
+         filter_output[i] = (int16_t)((filter_state[i] + (1 << (FILTER_FRACTION_BITS - 1))) >> FILTER_FRACTION_BITS);
+      }
+      else
+      {
+         filter_state[i] += sample[i] - filter_history[i][filter_index];
+         filter_history[i][filter_index] = sample[i];
+         filter_output[i] = (int16_t)((filter_state[i] + ((1 << length) >> 1)) >> length);
+      }
+   }
+   
+   if (!is_iir)
+   {
+      filter_index = (filter_index + 1) & ((1 << length) - 1);
    }
-}
-void core_callback_t_after_exec(void) {}
-void core_callback_t_new_second(void)
-{
-   second_counter = 0;
 }
 
 
+/************************************************************************/
+/* Enabled ports                                                        */
+/************************************************************************/
+/* REG_LOAD_CELLS always holds the 8 channels, but the register's pointer */
+/* and length are moved so that only the enabled ports are sent           */
+void reset_delta_reference(void);
 
-void process_thresholds(void);
+uint8_t load_cells_first_channel = 0;
+uint8_t load_cells_n_channels = 8;
 
-void core_callback_t_500us(void)
-{  
-   /* Pulse on DO0 */
-	if (pulse_counter_ms)
-	{
-		if (!(--pulse_counter_ms))
-		{
-			if (app_regs.REG_DO0_CONF == GM_DO0_PULSE)
-         {
-            clr_DO0;            
-			   app_regs.REG_DO0 = 0;
-			   app_regs.REG_DO_OUT &= ~(1<<0);
-         }            
-		}
-	}
-   
-   process_thresholds();
-}
+/* Enabled channels followed by the sequence number, when REG_SEQUENCE_ENABLE is set */
+int16_t load_cells_frame[9];
 
-void core_callback_t_1ms(void)
+void update_load_cells_payload(void)
 {
-   /* Update pots on Port 0 if the board is re-connected */
-   if (read_CS0_1)
-   {      
-      if (!port0_is_plugged)
-      {
-         update_pots_port0_counter = 250 + 4;   // 250 ms before update the pots
-      }
+   uint8_t index = ADD_REG_LOAD_CELLS - APP_REGS_ADD_MIN;
+   
+   switch (app_regs.REG_PORTS_ENABLE)
+   {
+      case B_PORT0:
+         load_cells_first_channel = 0;
+         load_cells_n_channels = 4;
+         break;
       
-      port0_is_plugged = true;
+      case B_PORT1:
+         load_cells_first_channel = 4;
+         load_cells_n_channels = 4;
+         break;
+      
+      default:
+         load_cells_first_channel = 0;
+         load_cells_n_channels = 8;
+         break;
+   }
+   
+   if (app_regs.REG_SEQUENCE_ENABLE)
+   {
+      app_regs_pointer[index] = (uint8_t*)(load_cells_frame);
+      app_regs_n_elements[index] = load_cells_n_channels + 1;
    }
    else
    {
-      port0_is_plugged = false;
+      app_regs_pointer[index] = (uint8_t*)(&app_regs.REG_LOAD_CELLS[load_cells_first_channel]);
+      app_regs_n_elements[index] = load_cells_n_channels;
    }
    
-   /* Update pots on Port 1 if the board is re-connected */ 
-   if (read_CS1_1)
-   {          
-      if (!port1_is_plugged)
-      {
-         update_pots_port1_counter = 250 + 4;   // 250 ms before update the pots
-      }
+   /* The delta frames follow the same layout, the sequence number only keeps its low byte */
+   app_regs_n_elements[ADD_REG_LOAD_CELLS_DELTA - APP_REGS_ADD_MIN] = app_regs_n_elements[index];
+   reset_delta_reference();
+}
+
+
+/************************************************************************/
+/* Sequence number                                                      */
+/************************************************************************/
+/* Counts every conversion, so the host sees a gap for each sample lost on the way */
+uint16_t sample_sequence = 0;
+uint16_t load_cells_sequence = 0;   // Sequence number of the first sample of the reported window
+
+void update_load_cells_frame(void)
+{
+   for (uint8_t i = 0; i < load_cells_n_channels; i++)
+   {
+      load_cells_frame[i] = app_regs.REG_LOAD_CELLS[load_cells_first_channel + i];
+   }
+   
+   load_cells_frame[load_cells_n_channels] = (int16_t)load_cells_sequence;
+}
+
+
+/************************************************************************/
+/* Delta encoding                                                       */
+/************************************************************************/
+bool send_event_if_room(uint8_t add, bool use_core_timestamp);
+
+int16_t delta_reference[8];               // Last frame sent, as the host has rebuilt it
+bool delta_reference_is_valid = false;
+uint8_t frames_since_keyframe = 0;
+
+void reset_delta_reference(void)
+{
+   delta_reference_is_valid = false;
+}
+
+/************************************************************************/
+/* Deadband                                                             */
+/************************************************************************/
+uint16_t deadband_heartbeat_frames = 0;   // REG_DEADBAND_HEARTBEAT_MS in reported frames, 0 for none
+uint16_t frames_since_event = 0;
+bool deadband_skipped_frames = false;
+
+void update_deadband_heartbeat(void)
+{
+   uint32_t period = 1000UL << app_regs.REG_DECIMATION;
+   uint32_t frames = ((uint32_t)app_regs.REG_DEADBAND_HEARTBEAT_MS * sample_rate_hz[app_regs.REG_SAMPLE_RATE]) / period;
+   
+   if (app_regs.REG_DEADBAND_HEARTBEAT_MS == 0)
+      deadband_heartbeat_frames = 0;
+   else
+      deadband_heartbeat_frames = (frames < 1) ? 1 : (frames > 65535) ? 65535 : frames;
+}
+
+/* True if no enabled channel moved more than REG_DEADBAND from the last frame sent */
+bool load_cells_in_deadband(int16_t * values)
+{
+   if (!delta_reference_is_valid)
+      return false;
+   
+   if (deadband_heartbeat_frames && ++frames_since_event >= deadband_heartbeat_frames)
+      return false;
+   
+   for (uint8_t i = 0; i < load_cells_n_channels; i++)
+   {
+      int32_t change = (int32_t)values[i] - delta_reference[i];
+      
+      if (change > app_regs.REG_DEADBAND || change < -(int32_t)app_regs.REG_DEADBAND)
+         return false;
+   }
+   
+   return true;
+}
+
+/* Sends REG_LOAD_CELLS either as a full frame or as the difference to the last one sent */
+void send_load_cells_event(void)
+{
+   int16_t * values = &app_regs.REG_LOAD_CELLS[load_cells_first_channel];
+   
+   if (app_regs.REG_DEADBAND)
+   {
+      if (load_cells_in_deadband(values))
+      {
+         deadband_skipped_frames = true;
+         return;
+      }
+      
+      frames_since_event = 0;
+   }
+   
+   /* Frames left out by the deadband would look like lost frames to the delta decoder */
+   bool keyframe = !delta_reference_is_valid || app_regs.REG_DELTA_KEYFRAME_INTERVAL == 0 ||
+                   frames_since_keyframe + 1 >= app_regs.REG_DELTA_KEYFRAME_INTERVAL ||
+                   deadband_skipped_frames;
+   
+   deadband_skipped_frames = false;
+   
+   for (uint8_t i = 0; i < load_cells_n_channels && !keyframe; i++)
+   {
+      int16_t delta = values[i] - delta_reference[i];
+      
+      /* Escape to a full frame when a channel moves too much */
+      if (delta < -128 || delta > 127)
+         keyframe = true;
+      else
+         app_regs.REG_LOAD_CELLS_DELTA[i] = (int8_t)delta;
+   }
+   
+   /* A frame left out breaks the host's rebuild of the next deltas, so a keyframe follows it */
+   if (keyframe)
+   {
+      delta_reference_is_valid = send_event_if_room(ADD_REG_LOAD_CELLS, false);
+      frames_since_keyframe = 0;
+   }
+   else
+   {
+      if (app_regs.REG_SEQUENCE_ENABLE)
+         app_regs.REG_LOAD_CELLS_DELTA[load_cells_n_channels] = (int8_t)load_cells_sequence;
+      
+      delta_reference_is_valid = send_event_if_room(ADD_REG_LOAD_CELLS_DELTA, false);
+      frames_since_keyframe++;
+   }
+   
+   for (uint8_t i = 0; i < load_cells_n_channels; i++)
+   {
+      delta_reference[i] = values[i];
+   }
+}
+
+
+/************************************************************************/
+/* Batch of frames                                                      */
+/************************************************************************/
+uint8_t batch_counter = 0;       // Frames already in REG_LOAD_CELLS_BATCH
+uint32_t batch_second;           // Timestamp of the first frame
+uint16_t batch_usecond;
+
+
+/************************************************************************/
+/* Auto-zero                                                            */
+/************************************************************************/
+/* Each selected channel searches, in parallel, the offset that brings  */
+/* its reading closest to zero. Both ends of the range are measured     */
+/* first, then the interval with the sign change is halved (~11 steps)  */
+/* A step lets the signal settle and averages a few samples             */
+#define AUTO_ZERO_SETTLE_SAMPLES 4
+#define AUTO_ZERO_AVG_SAMPLES    16
+
+uint8_t auto_zero_step;
+uint8_t auto_zero_sample_counter;
+int32_t auto_zero_accumulator[8];
+int16_t auto_zero_lo[8];         // Offsets bracketing the zero crossing ...
+int16_t auto_zero_hi[8];
+int16_t auto_zero_lo_reading[8]; // ... and their averaged readings
+int16_t auto_zero_hi_reading[8];
+
+void update_offsets (uint8_t load_cell_channel);
+
+void set_auto_zero_offsets(uint8_t channels, int16_t * offsets)
+{
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (channels & (1<<i))
+      {
+         *((&app_regs.REG_OFFSET_CH0)+i) = offsets[i];
+      }
+   }
+   
+   /* update_offsets() writes channel i and i+2 on the same pot */
+   if (channels & (B_CH0 | B_CH2)) update_offsets(0);
+   if (channels & (B_CH1 | B_CH3)) update_offsets(1);
+   if (channels & (B_CH4 | B_CH6)) update_offsets(4);
+   if (channels & (B_CH5 | B_CH7)) update_offsets(5);
+}
+
+void start_auto_zero(uint8_t channels)
+{
+   app_regs.REG_AUTO_ZERO = 0;
+   
+   auto_zero_step = 0;
+   auto_zero_sample_counter = 0;
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      auto_zero_accumulator[i] = 0;
+      auto_zero_lo[i] = -255;
+      auto_zero_hi[i] = 255;
+   }
+   
+   app_regs.REG_AUTO_ZERO = channels;
+}
+
+void process_auto_zero(int16_t * sample, uint8_t valid_channels)
+{
+   if (app_regs.REG_AUTO_ZERO == 0)
+      return;
+   
+   /* Channels without a board can't be zeroed and keep their offsets */
+   uint8_t done = app_regs.REG_AUTO_ZERO & ~valid_channels;
+   
+   /* The search starts at the low end of the range */
+   if (auto_zero_step == 0)
+   {
+      set_auto_zero_offsets(app_regs.REG_AUTO_ZERO & valid_channels, auto_zero_lo);
+      auto_zero_step++;
+   }
+   else if (++auto_zero_sample_counter > AUTO_ZERO_SETTLE_SAMPLES)
+   {
+      for (uint8_t i = 0; i < 8; i++)
+      {
+         auto_zero_accumulator[i] += sample[i];
+      }
+   }
+   
+   if (auto_zero_sample_counter == AUTO_ZERO_SETTLE_SAMPLES + AUTO_ZERO_AVG_SAMPLES)
+   {
+      int16_t next_offsets[8];
+      
+      for (uint8_t i = 0; i < 8; i++)
+      {
+         int16_t reading = auto_zero_accumulator[i] / AUTO_ZERO_AVG_SAMPLES;
+         auto_zero_accumulator[i] = 0;
+         
+         if (!(app_regs.REG_AUTO_ZERO & ~done & (1<<i)))
+            continue;
+         
+         if (auto_zero_step == 1)
+         {
+            auto_zero_lo_reading[i] = reading;
+            next_offsets[i] = auto_zero_hi[i];
+            continue;
+         }
+         
+         if (auto_zero_step == 2)
+         {
+            auto_zero_hi_reading[i] = reading;
+         }
+         else if ((reading < 0) == (auto_zero_lo_reading[i] < 0))
+         {
+            auto_zero_lo[i] = *((&app_regs.REG_OFFSET_CH0)+i);
+            auto_zero_lo_reading[i] = reading;
+         }
+         else
+         {
+            auto_zero_hi[i] = *((&app_regs.REG_OFFSET_CH0)+i);
+            auto_zero_hi_reading[i] = reading;
+         }
+         
+         /* Without a sign change the zero is out of range and the closest end is kept */
+         bool no_crossing = (auto_zero_lo_reading[i] < 0) == (auto_zero_hi_reading[i] < 0);
+         
+         if (no_crossing || auto_zero_hi[i] - auto_zero_lo[i] <= 1)
+         {
+            int16_t lo_error = (auto_zero_lo_reading[i] < 0) ? -auto_zero_lo_reading[i] : auto_zero_lo_reading[i];
+            int16_t hi_error = (auto_zero_hi_reading[i] < 0) ? -auto_zero_hi_reading[i] : auto_zero_hi_reading[i];
+            
+            if (lo_error <= hi_error)
+               next_offsets[i] = auto_zero_lo[i];
+            else
+               next_offsets[i] = auto_zero_hi[i];
+            
+            done |= (1<<i);
+         }
+         else
+         {
+            next_offsets[i] = (auto_zero_lo[i] + auto_zero_hi[i]) / 2;
+         }
+      }
+      
+      set_auto_zero_offsets(app_regs.REG_AUTO_ZERO & valid_channels, next_offsets);
+      
+      auto_zero_step++;
+      auto_zero_sample_counter = 0;
+   }
+   
+   if (done)
+   {
+      app_regs.REG_AUTO_ZERO &= ~done;
+      
+      /* Report the offsets found */
+      for (uint8_t i = 0; i < 8; i++)
+      {
+         if (done & valid_channels & (1<<i))
+         {
+            core_func_send_event(ADD_REG_OFFSET_CH0 + i, true);
+         }
+      }
+      
+      if (app_regs.REG_AUTO_ZERO == 0)
+      {
+         core_func_send_event(ADD_REG_AUTO_ZERO, true);
+      }
+   }
+}
+
+
+/************************************************************************/
+/* Initialization Callbacks                                             */
+/************************************************************************/
+void core_callback_define_clock_default(void) {}
+
+void initialize_do_schedule_timer(void);
+void initialize_di0_capture(void);
+
+void core_callback_initialize_hardware(void)
+{
+	/* Initialize IOs */
+	/* Don't delete this function!!! */
+	init_ios();
+    
+   /* Initialize both SPI with 4MHz */
+   SPID_CTRL = SPI_MASTER_bm | SPI_ENABLE_bm | SPI_MODE_0_gc | SPI_CLK2X_bm | SPI_PRESCALER_DIV16_gc;
+   SPIC_CTRL = SPI_MASTER_bm | SPI_ENABLE_bm | SPI_MODE_0_gc | SPI_CLK2X_bm | SPI_PRESCALER_DIV16_gc;
+
+   /* Initialize the DMA used to read the ADCs */
+   adc_dma_initialize();
+   
+   /* Route TCC0 and TCD0 compare A to CONVST0 (PC4) and CONVST1 (PD4) */
+   PORTC.REMAP = PORT_TC0A_bm;
+   PORTD.REMAP = PORT_TC0A_bm;
+   
+   /* TCD1 times the DO schedule */
+   initialize_do_schedule_timer();
+   
+   /* TCE0 captures the edges of DI0 */
+   initialize_di0_capture();
+}
+
+void core_callback_reset_registers(void)
+{
+	/* Initialize registers */
+   app_regs.REG_START = 0;
+   
+   app_regs.REG_DO0 = 0;
+   
+   app_regs.REG_DI0_CONF = GM_DI0_SYNC;
+   app_regs.REG_DO0_CONF = GM_DO0_DIG;
+   app_regs.REG_DO0_PULSE = 10;
+   
+   app_regs.REG_DO_SET = 0;
+   app_regs.REG_DO_CLEAR = 0;
+   app_regs.REG_DO_CLEAR = 0;
+   app_regs.REG_DO_OUT = 0;
+   
+   app_regs.REG_LOAD_CELLS[0] = 0;
+   app_regs.REG_LOAD_CELLS[1] = 0;
+   app_regs.REG_LOAD_CELLS[2] = 0;
+   app_regs.REG_LOAD_CELLS[3] = 0;
+   app_regs.REG_LOAD_CELLS[4] = 0;
+   app_regs.REG_LOAD_CELLS[5] = 0;
+   app_regs.REG_LOAD_CELLS[6] = 0;
+   app_regs.REG_LOAD_CELLS[7] = 0;
+   
+   app_regs.REG_DO0_CH = GM_SOFTWARE;
+   app_regs.REG_DO1_CH = GM_SOFTWARE;
+   app_regs.REG_DO2_CH = GM_SOFTWARE;
+   app_regs.REG_DO3_CH = GM_SOFTWARE;
+   app_regs.REG_DO4_CH = GM_SOFTWARE;
+   app_regs.REG_DO5_CH = GM_SOFTWARE;
+   app_regs.REG_DO6_CH = GM_SOFTWARE;
+   app_regs.REG_DO7_CH = GM_SOFTWARE;
+   app_regs.REG_DO0_TH_VALUE = 0;
+   app_regs.REG_DO1_TH_VALUE = 0;
+   app_regs.REG_DO2_TH_VALUE = 0;
+   app_regs.REG_DO3_TH_VALUE = 0;
+   app_regs.REG_DO4_TH_VALUE = 0;
+   app_regs.REG_DO5_TH_VALUE = 0;
+   app_regs.REG_DO5_TH_VALUE = 0;
+   app_regs.REG_DO6_TH_VALUE = 0;
+   app_regs.REG_DO7_TH_VALUE = 0;
+   app_regs.REG_DO0_TH_UP_MS = 0;
+   app_regs.REG_DO1_TH_UP_MS = 0;
+   app_regs.REG_DO2_TH_UP_MS = 0;
+   app_regs.REG_DO3_TH_UP_MS = 0;
+   app_regs.REG_DO4_TH_UP_MS = 0;
+   app_regs.REG_DO5_TH_UP_MS = 0;
+   app_regs.REG_DO6_TH_UP_MS = 0;
+   app_regs.REG_DO7_TH_UP_MS = 0;
+   app_regs.REG_DO0_TH_DOWN_MS = 0;
+   app_regs.REG_DO1_TH_DOWN_MS = 0;
+   app_regs.REG_DO2_TH_DOWN_MS = 0;
+   app_regs.REG_DO3_TH_DOWN_MS = 0;
+   app_regs.REG_DO4_TH_DOWN_MS = 0;
+   app_regs.REG_DO5_TH_DOWN_MS = 0;
+   app_regs.REG_DO6_TH_DOWN_MS = 0;
+   app_regs.REG_DO7_TH_DOWN_MS = 0;
+   
+   app_regs.REG_OFFSET_CH0 = 0;
+   app_regs.REG_OFFSET_CH1 = 0;
+   app_regs.REG_OFFSET_CH2 = 0;
+   app_regs.REG_OFFSET_CH3 = 0;
+   app_regs.REG_OFFSET_CH4 = 0;
+   app_regs.REG_OFFSET_CH5 = 0;
+   app_regs.REG_OFFSET_CH6 = 0;
+   app_regs.REG_OFFSET_CH7 = 0;   
+   
+	app_regs.REG_EVNT_ENABLE = B_EVT_LOAD_CELLS | B_EVT_DI0 | B_EVT_DO0 | B_EVT_DO_OUT;
+   
+   app_regs.REG_SAMPLE_RATE = GM_SAMPLE_RATE_1000HZ;
+   app_regs.REG_DECIMATION = GM_DECIMATION_NONE;
+   
+   for (uint8_t i = 0; i < 8*BATCH_SIZE_MAX; i++)
+   {
+      app_regs.REG_LOAD_CELLS_BATCH[i] = 0;
+   }
+   app_regs.REG_BATCH_SIZE = 1;
+   
+   app_regs.REG_PORTS_ENABLE = B_PORT0 | B_PORT1;
+   app_regs.REG_THRESHOLDS_MODE = GM_THRESHOLDS_DECIMATED;
+   app_regs.REG_THRESHOLDS_LATENCY = 0;
+   app_regs.REG_AUTO_ZERO = 0;
+   app_regs.REG_SEQUENCE_ENABLE = 0;
+   app_regs.REG_DELTA_KEYFRAME_INTERVAL = 0;
+   app_regs.REG_DEADBAND = 0;
+   app_regs.REG_DEADBAND_HEARTBEAT_MS = 1000;
+   app_regs.REG_FILTER_MODE = GM_FILTER_NONE;
+   app_regs.REG_FILTER_LENGTH = 2;
+   app_regs.REG_FILTER_CHANNELS = 0xFF;
+   app_regs.REG_FILTER_TARGETS = B_FILTER_THRESHOLDS;
+   
+   for (uint8_t i = 0; i < 8*VIRTUAL_N_CHANNELS; i++)
+   {
+      app_regs.REG_VIRTUAL_WEIGHTS[i] = 0;
+   }
+   for (uint8_t i = 0; i < VIRTUAL_N_CHANNELS; i++)
+   {
+      app_regs.REG_VIRTUAL_SHIFT[i] = 0;
+      app_regs.REG_LOAD_CELLS_VIRTUAL[i] = 0;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_TH_COMPARATOR[i] = GM_COMPARATOR_LEVEL;
+      app_regs.REG_DO_TH_LOW_VALUE[i] = 0;
+      app_regs.REG_DO_TH_SLOPE_SAMPLES[i] = 1;
+      app_regs.REG_DO_LOGIC[i] = GM_LOGIC_COMPARATOR;
+      app_regs.REG_DO_LOGIC_INPUTS[i] = 0;
+      app_regs.REG_DO_PULSE_WIDTH_MS[i] = 0;
+      app_regs.REG_DO_PULSE_PERIOD_MS[i] = 0;
+      app_regs.REG_DO_PULSE_COUNT[i] = 1;
+   }
+   
+   for (uint8_t i = 0; i < 2*SCHEDULE_MAX_ENTRIES; i++)
+   {
+      app_regs.REG_DO_SCHEDULE[i] = 0;
+   }
+   app_regs.REG_DO_SCHEDULE_LENGTH = 0;
+   app_regs.REG_DO_SCHEDULE_START_TIME[0] = 0;
+   app_regs.REG_DO_SCHEDULE_START_TIME[1] = 0;
+   app_regs.REG_DO_SCHEDULE_START = GM_SCHEDULE_STOP;
+   
+   app_regs.REG_DI0_EDGE[0] = 0;
+   app_regs.REG_DI0_EDGE[1] = 0;
+   
+   for (uint8_t i = 0; i < PERF_N_COUNTERS; i++)
+   {
+      app_regs.REG_PERF_COUNTERS[i] = 0;
+   }
+}
+
+void update_virtual_channel_inputs(void);
+void reset_slopes(void);
+void update_pulsed_outputs(void);
+void stop_do_schedule(void);
+void update_di0_capture(void);
+
+void core_callback_registers_were_reinitialized(void)
+{   
+   /* An erased EEPROM or one saved by other firmware may hold values the writes would refuse */
+   if (app_regs.REG_SAMPLE_RATE > GM_SAMPLE_RATE_2000HZ)
+      app_regs.REG_SAMPLE_RATE = GM_SAMPLE_RATE_1000HZ;
+   
+   if (app_regs.REG_DECIMATION > GM_DECIMATION_AVG16)
+      app_regs.REG_DECIMATION = GM_DECIMATION_NONE;
+   
+   if (app_regs.REG_BATCH_SIZE < 1 || app_regs.REG_BATCH_SIZE > BATCH_SIZE_MAX)
+      app_regs.REG_BATCH_SIZE = 1;
+   
+   if (app_regs.REG_FILTER_MODE > GM_FILTER_MOVING_AVERAGE)
+      app_regs.REG_FILTER_MODE = GM_FILTER_NONE;
+   
+   if (app_regs.REG_FILTER_LENGTH > FILTER_LENGTH_MAX ||
+      (app_regs.REG_FILTER_MODE == GM_FILTER_MOVING_AVERAGE && app_regs.REG_FILTER_LENGTH > FILTER_MA_LENGTH_MAX))
+      app_regs.REG_FILTER_LENGTH = 2;
+   
+   /* The counters restored from the EEPROM belong to an older session */
+   app_write_REG_PERF_COUNTERS(app_regs.REG_PERF_COUNTERS);
+   
+   /* The search state of an auto-zero isn't saved, so it doesn't resume */
+   app_regs.REG_AUTO_ZERO = 0;
+   
+   /* Update outputs with the saved state */
+   app_write_REG_DO_OUT(&app_regs.REG_DO_OUT);
+   
+   /* Send only the enabled ports */
+   update_load_cells_payload();
+   
+   /* Skip the channels without weight on the virtual channels */
+   update_virtual_channel_inputs();
+   
+   /* The slopes restart from the next sample */
+   reset_slopes();
+   
+   /* No pulses are on going after a reset */
+   update_pulsed_outputs();
+   
+   /* Nor a DO schedule, even if one was saved as playing */
+   stop_do_schedule();
+   
+   /* Capture DI0 if its event was saved as enabled */
+   update_di0_capture();
+   
+   /* Start the sample timer */
+   update_sample_rate();
+}
+
+/************************************************************************/
+/* Callbacks: Visualization                                             */
+/************************************************************************/
+void core_callback_visualen_to_on(void)
+{
+	/* Update channels enable indicators */
+	//update_enabled_pwmx();
+}
+
+void core_callback_visualen_to_off(void)
+{
+	/* Clear all the enabled indicators */
+}
+
+/************************************************************************/
+/* Callbacks: Change on the operation mode                              */
+/************************************************************************/
+void core_callback_device_to_standby(void) {}
+void core_callback_device_to_active(void) {}
+void core_callback_device_to_enchanced_active(void) {}
+void core_callback_device_to_speed(void) {}
+
+/************************************************************************/
+/* Callbacks: 1 ms timer                                                */
+/************************************************************************/
+bool port0_is_plugged = false;
+bool port1_is_plugged = false;
+
+uint8_t update_pots_port0_counter = 0;
+uint8_t update_pots_port1_counter = 0;
+
+/* Offsets written by the host, their pots are updated between two readouts */
+/* Each flag is a single byte, so the write handlers can set it at any time */
+uint8_t offsets_pending[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+uint16_t second_counter = 0;
+
+uint16_t pulse_counter_ms = 0;
+
+void update_pots_on_port0(void)
+{
+     /* The pots share the SPI pins with the ADC, wait until the DMA is done */
+     if (adc_dma_pending)
+        return;
+     
+     for (uint8_t i = 0; i < 4; i++)
+     {
+        if (offsets_pending[i])
+        {
+           offsets_pending[i] = 0;
+           update_offsets(i);
+        }
+     }
+     
+     if (update_pots_port0_counter)
+     {
+        update_pots_port0_counter--;
+        
+        if (update_pots_port0_counter == 0) update_offsets(0);
+        if (update_pots_port0_counter == 1) update_offsets(1);
+        if (update_pots_port0_counter == 2) update_offsets(2);
+        if (update_pots_port0_counter == 3) update_offsets(3);
+     }
+}
+
+void update_pots_on_port1(void)
+{
+     if (adc_dma_pending)
+        return;
+     
+     for (uint8_t i = 4; i < 8; i++)
+     {
+        if (offsets_pending[i])
+        {
+           offsets_pending[i] = 0;
+           update_offsets(i);
+        }
+     }
+     
+     if (update_pots_port1_counter)
+     { 
+        update_pots_port1_counter--;
+        
+        if (update_pots_port1_counter == 0) update_offsets(4);
+        if (update_pots_port1_counter == 1) update_offsets(5);
+        if (update_pots_port1_counter == 2) update_offsets(6);
+        if (update_pots_port1_counter == 3) update_offsets(7);
+     }
+}
+
+void core_callback_t_before_exec(void)
+{
+   if (++second_counter == 2000)
+   {
+      if (app_regs.REG_START)
+      {
+         if (app_regs.REG_DO0_CONF == GM_DO0_TGL_EACH_SEC)
+         {
+            app_read_REG_DO0();
+            app_regs.REG_DO0 ^= 1;
+            app_write_REG_DO0(&app_regs.REG_DO0);
+                
+            if (app_regs.REG_EVNT_ENABLE & B_EVT_DO0)
+            {
+               core_func_send_event(ADD_REG_DO0, true);
+            }
+         }
+      }
+   }
+}
+void core_callback_t_after_exec(void) {}
+void core_callback_t_new_second(void)
+{
+   second_counter = 0;
+}
+
+
+
+void process_thresholds(int16_t * values);
+void process_pulse_trains(void);
+void check_do_schedule_start_time(void);
+void send_di0_edges(void);
+
+void core_callback_t_500us(void)
+{  
+   /* Pulse on DO0 */
+	if (pulse_counter_ms)
+	{
+		if (!(--pulse_counter_ms))
+		{
+			if (app_regs.REG_DO0_CONF == GM_DO0_PULSE)
+         {
+            clr_DO0;            
+			   app_regs.REG_DO0 = 0;
+			   app_regs.REG_DO_OUT &= ~(1<<0);
+         }            
+		}
+	}
+   
+   /* Pulses fired by the thresholds */
+   process_pulse_trains();
+   
+   /* DI0 edges queued by the capture */
+   send_di0_edges();
+}
+
+void core_callback_t_1ms(void)
+{
+   /* Update pots on Port 0 if the board is re-connected */
+   if (read_CS0_1)
+   {      
+      if (!port0_is_plugged)
+      {
+         update_pots_port0_counter = 250 + 4;   // 250 ms before update the pots
+      }
+      
+      port0_is_plugged = true;
+   }
+   else
+   {
+      port0_is_plugged = false;
+   }
+   
+   /* Update pots on Port 1 if the board is re-connected */ 
+   if (read_CS1_1)
+   {          
+      if (!port1_is_plugged)
+      {
+         update_pots_port1_counter = 250 + 4;   // 250 ms before update the pots
+      }
           
       port1_is_plugged = true;
    }
-   else
+   else
+   {
+      port1_is_plugged = false;
+   }
+   
+   update_pots_on_port0();
+   update_pots_on_port1();
+   
+   check_do_schedule_start_time();
+}
+
+/************************************************************************/
+/* Callbacks: cloc control                                              */
+/************************************************************************/
+void core_callback_clock_to_repeater(void) {}
+void core_callback_clock_to_generator(void) {}
+void core_callback_clock_to_unlock(void) {}
+void core_callback_clock_to_lock(void) {}
+
+/************************************************************************/
+/* Callbacks: uart control                                              */
+/************************************************************************/
+void core_callback_uart_rx_before_exec(void) {}
+void core_callback_uart_rx_after_exec(void) {}
+void core_callback_uart_tx_before_exec(void) {}
+void core_callback_uart_tx_after_exec(void) {}
+void core_callback_uart_cts_before_exec(void) {}
+void core_callback_uart_cts_after_exec(void) {}
+
+/************************************************************************/
+/* Callbacks: Read app register                                         */
+/************************************************************************/
+bool core_read_app_register(uint8_t add, uint8_t type)
+{
+	/* Check if it will not access forbidden memory */
+	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+		return false;
+	
+	/* Check if type matches */
+	if (app_regs_type[add-APP_REGS_ADD_MIN] != type)
+		return false;
+	
+	/* Receive data */
+	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+
+	/* Return success */
+	return true;
+}
+
+/************************************************************************/
+/* Callbacks: Write app register                                        */
+/************************************************************************/
+bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint16_t n_elements)
+{
+	/* Check if it will not access forbidden memory */
+	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
+		return false;
+	
+	/* Check if type matches */
+	if (app_regs_type[add-APP_REGS_ADD_MIN] != type)
+		return false;
+
+	/* Check if the number of elements matches */
+	if (app_regs_n_elements[add-APP_REGS_ADD_MIN] != n_elements)
+		return false;
+
+	/* Process data and return false if write is not allowed or contains errors */
+	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+}
+
+/************************************************************************/
+/* Performance counters                                                 */
+/************************************************************************/
+/* Ring buffer of hwbp_core_com: hwbp_uart_xmit() writes at the head and the UART empties it from the tail */
+extern volatile uint16_t hwbp_uart_head;
+extern volatile uint16_t hwbp_uart_tail;
+
+/* Header, timestamp and checksum of an event */
+#define EVENT_OVERHEAD_BYTES 12
+
+/* Sample timer ticks since start, TCC0 restarts at every CONVST */
+uint16_t sample_timer_elapsed(uint16_t start)
+{
+   uint16_t end = TCC0.CNT;
+   return (end >= start) ? end - start : end + TCC0.PER + 1 - start;
+}
+
+void perf_keep_max_cycles(uint8_t counter, uint16_t ticks)
+{
+   uint32_t cycles = SAMPLE_TIMER_TICKS_TO_CYCLES(ticks);
+   
+   if (cycles > app_regs.REG_PERF_COUNTERS[counter])
+      app_regs.REG_PERF_COUNTERS[counter] = cycles;
+}
+
+/* Sends the event only if the TX buffer can take all of it, so the host never gets a broken stream */
+/* Bytes the TX buffer would hold with an event of register add */
+uint16_t tx_buffer_bytes_with(uint8_t add)
+{
+   uint16_t tail;
+   
+   /* The UART interrupt can move the tail between the two byte reads */
+   do {
+      tail = hwbp_uart_tail;
+   } while (tail != hwbp_uart_tail);
+   
+   uint16_t used = (hwbp_uart_head >= tail) ? hwbp_uart_head - tail : hwbp_uart_head + HWBP_UART_TXBUFSIZ - tail;
+   uint16_t bytes = app_regs_n_elements[add-APP_REGS_ADD_MIN] * (app_regs_type[add-APP_REGS_ADD_MIN] & MSK_TYPE_LEN) + EVENT_OVERHEAD_BYTES;
+   
+   return used + bytes;
+}
+
+bool send_event_if_room(uint8_t add, bool use_core_timestamp)
+{
+   uint16_t bytes = tx_buffer_bytes_with(add);
+   
+   if (bytes >= HWBP_UART_TXBUFSIZ)
+   {
+      app_regs.REG_PERF_COUNTERS[PERF_EVENTS_DROPPED]++;
+      return false;
+   }
+   
+   core_func_send_event(add, use_core_timestamp);
+   
+   if (bytes > app_regs.REG_PERF_COUNTERS[PERF_TX_BUFFER_MAX])
+      app_regs.REG_PERF_COUNTERS[PERF_TX_BUFFER_MAX] = bytes;
+   
+   return true;
+}
+
+/************************************************************************/
+/* Virtual channels                                                     */
+/************************************************************************/
+/* Each virtual channel is the sum of the channels times their weight,  */
+/* shifted right by REG_VIRTUAL_SHIFT and saturated to 16 bits          */
+uint8_t virtual_channel_inputs[VIRTUAL_N_CHANNELS];   // Channels with a weight, the others are skipped
+
+void update_virtual_channel_inputs(void)
+{
+   for (uint8_t v = 0; v < VIRTUAL_N_CHANNELS; v++)
+   {
+      virtual_channel_inputs[v] = 0;
+      
+      for (uint8_t i = 0; i < 8; i++)
+      {
+         if (app_regs.REG_VIRTUAL_WEIGHTS[v*8 + i])
+            virtual_channel_inputs[v] |= (1<<i);
+      }
+   }
+}
+
+void compute_virtual_channels(int16_t * values, int16_t * virtual_values)
+{
+   int8_t * weights = app_regs.REG_VIRTUAL_WEIGHTS;
+   
+   for (uint8_t v = 0; v < VIRTUAL_N_CHANNELS; v++, weights += 8)
+   {
+      int32_t sum = 0;
+      uint8_t inputs = virtual_channel_inputs[v];
+      
+      for (uint8_t i = 0; inputs; i++, inputs >>= 1)
+      {
+         if (inputs & 1)
+            sum += (int32_t)weights[i] * values[i];
+      }
+      
+      sum >>= app_regs.REG_VIRTUAL_SHIFT[v];
+      
+      if (sum > INT16_MAX) sum = INT16_MAX;
+      if (sum < INT16_MIN) sum = INT16_MIN;
+      
+      virtual_values[v] = (int16_t)sum;
+   }
+}
+
+/************************************************************************/
+/* Pulse trains                                                         */
+/************************************************************************/
+/* The outputs with a pulse width fire REG_DO_PULSE_COUNT pulses when   */
+/* their threshold is crossed, instead of following it. All the trains  */
+/* share one ms clock, each output only keeps the time of its next edge */
+/* Only process_pulse_trains() changes pulse_trains_running. The other  */
+/* contexts leave requests in single byte flags, which can't be torn    */
+uint16_t pulse_clock_ms = 0;
+uint8_t pulse_trains_running = 0;      // Outputs in the middle of a train
+uint16_t pulse_next_edge_ms[8];
+uint8_t pulse_left[8];                 // Pulses still to start, the current one included
+uint8_t pulse_start_requested[8];      // First pulse set by the thresholds, the train starts on the next tick
+uint8_t pulse_release_requested[8];    // First pulse of a train dropped by a stop, released on the next tick
+uint8_t pulse_trains_stop = 0;         // The pulses were reconfigured, the trains stop on the next tick
+uint8_t pulse_requests_pending = 0;    // Set after any of the two above
+
+/* Outputs whose threshold was qualified as active, as seen by the pulses */
+uint8_t thresholds_latched = 0;
+
+/* Outputs that fire pulses instead of following their threshold */
+uint8_t pulsed_outputs = 0;
+
+/* Called when the pulses are reconfigured, the outputs still high are released on the next tick */
+void update_pulsed_outputs(void)
+{
+   uint8_t pulsed = 0;
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (app_regs.REG_DO_PULSE_WIDTH_MS[i])
+         pulsed |= (1<<i);
+      
+      /* Its first pulse is already high, but the tick won't see the train to end it */
+      if (pulse_start_requested[i])
+         pulse_release_requested[i] = 1;
+      
+      pulse_start_requested[i] = 0;
+   }
+   
+   pulsed_outputs = pulsed;
+   pulse_trains_stop = 1;
+   pulse_requests_pending = 1;
+}
+
+/* Outputs whose train was requested and hasn't started yet */
+uint8_t pulse_trains_requested(void)
+{
+   uint8_t requested = 0;
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (pulse_start_requested[i])
+         requested |= (1<<i);
+   }
+   
+   return requested;
+}
+
+/* Called with the outputs just set, the first pulse has started */
+void start_pulse_trains(uint8_t outputs)
+{
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (outputs & (1<<i))
+         pulse_start_requested[i] = 1;
+   }
+   
+   pulse_requests_pending = 1;
+}
+
+void process_pulse_trains(void)
+{
+   pulse_clock_ms++;
+   
+   uint16_t do_set = 0;
+   uint16_t do_clr = 0;
+   
+   /* Cleared before the requests are read, so a request made meanwhile is seen on the next tick */
+   if (pulse_requests_pending)
+   {
+      pulse_requests_pending = 0;
+      
+      if (pulse_trains_stop)
+      {
+         pulse_trains_stop = 0;
+         do_clr = pulse_trains_running;
+         pulse_trains_running = 0;
+         
+         for (uint8_t i = 0; i < 8; i++)
+         {
+            if (pulse_release_requested[i])
+            {
+               pulse_release_requested[i] = 0;
+               do_clr |= (1<<i);
+            }
+         }
+         
+         do_clr &= app_regs.REG_DO_OUT;
+      }
+      
+      for (uint8_t i = 0; i < 8; i++)
+      {
+         if (!pulse_start_requested[i])
+            continue;
+         
+         /* The pulse started between the last tick and this one, so it lasts from width to width + 1 ms, as on DO0 */
+         pulse_next_edge_ms[i] = pulse_clock_ms + app_regs.REG_DO_PULSE_WIDTH_MS[i];
+         pulse_left[i] = app_regs.REG_DO_PULSE_COUNT[i];
+         pulse_trains_running |= (1<<i);
+         pulse_start_requested[i] = 0;
+      }
+   }
+   
+   if (!(pulse_trains_running | do_clr))
+      return;
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (!(pulse_trains_running & (1<<i)) || pulse_next_edge_ms[i] != pulse_clock_ms)
+         continue;
+      
+      uint16_t width = app_regs.REG_DO_PULSE_WIDTH_MS[i];
+      uint16_t period = app_regs.REG_DO_PULSE_PERIOD_MS[i];
+      
+      /* The output is low for 1 ms at least */
+      if (period <= width)
+         period = width + 1;
+      
+      if (app_regs.REG_DO_OUT & (1<<i))
+      {
+         do_clr |= (1<<i);
+         
+         if (--pulse_left[i])
+            pulse_next_edge_ms[i] += period - width;
+         else
+            pulse_trains_running &= ~(1<<i);
+      }
+      else
+      {
+         do_set |= (1<<i);
+         pulse_next_edge_ms[i] += width;
+      }
+   }
+   
+   if (!(do_set | do_clr))
+      return;
+   
+   if (do_set) app_write_REG_DO_SET(&do_set);
+   if (do_clr) app_write_REG_DO_CLEAR(&do_clr);
+   
+   if (app_regs.REG_EVNT_ENABLE & B_EVT_DO_OUT)
    {
-      port1_is_plugged = false;
+      core_func_send_event(ADD_REG_DO_OUT, true);
+   }
+}
+
+
+/************************************************************************/
+/* DO schedule                                                          */
+/************************************************************************/
+/* TCD1 runs free at 4 MHz and its compare A plays the entries. Each    */
+/* delay is counted from the time the previous entry was due, so the    */
+/* latency of the interrupt doesn't add up along the schedule. Entries  */
+/* are never played early, the ones due while the interrupt is still    */
+/* busy are played late, right after the one before                     */
+#define SCHEDULE_CHUNK_TICKS 0x8000    // Longer delays take several compares
+
+uint8_t schedule_index = 0;         // Next entry to play
+uint32_t schedule_ticks_left = 0;   // Ticks from the last compare to the next entry
+
+void initialize_do_schedule_timer(void)
+{
+   TCD1.CTRLA = TC_CLKSEL_OFF_gc;
+   TCD1.CTRLFSET = TC_CMD_RESET_gc;
+   TCD1.CTRLB = TC_WGMODE_NORMAL_gc;
+   TCD1.PER = 0xFFFF;
+   TCD1.CTRLA = TC_CLKSEL_DIV8_gc;
+}
+
+void stop_do_schedule(void)
+{
+   TCD1.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+   app_regs.REG_DO_SCHEDULE_START = GM_SCHEDULE_STOP;
+}
+
+void play_schedule_entry(uint8_t index)
+{
+   uint32_t entry = app_regs.REG_DO_SCHEDULE[index*2 + 1];
+   uint16_t outputs = entry & MSK_SCHEDULE_OUTPUTS;
+   
+   switch (entry >> 16)
+   {
+      case SCHEDULE_ACTION_SET:    app_write_REG_DO_SET(&outputs);    break;
+      case SCHEDULE_ACTION_CLEAR:  app_write_REG_DO_CLEAR(&outputs);  break;
+      case SCHEDULE_ACTION_TOGGLE: app_write_REG_DO_TOGGLE(&outputs); break;
    }
+}
+
+/* Plays the entries that are due and arms the compare for the next one, from is when the last compare was due */
+void advance_do_schedule(uint16_t from)
+{
+   bool played = false;
    
-   /* Read Load Cells */
-   if (app_regs.REG_START)
+   while (app_regs.REG_DO_SCHEDULE_START != GM_SCHEDULE_STOP)
    {
-      core_func_mark_user_timestamp();
+      uint16_t elapsed = TCD1.CNT - from;
       
-      if (read_CS0_1)
+      if (schedule_ticks_left <= elapsed)
       {
-         /* If ADC board is plugged into Port0, set ADC CONVST */
-         set_CS0_0;
+         /* It came due while the entry before was being played */
+         if (played && app_regs.REG_DO_SCHEDULE[schedule_index*2])
+            app_regs.REG_PERF_COUNTERS[PERF_SCHEDULE_ENTRIES_MERGED]++;
+         
+         play_schedule_entry(schedule_index);
+         played = true;
+         
+         if (++schedule_index >= app_regs.REG_DO_SCHEDULE_LENGTH)
+         {
+            stop_do_schedule();
+            break;
+         }
+         
+         schedule_ticks_left += app_regs.REG_DO_SCHEDULE[schedule_index*2] * SAMPLE_TIMER_TICKS_PER_US;
+         continue;
       }
       
-      if (read_CS1_1)
-      {
-         /* If ADC board is plugged into Port1, set ADC CONVST */
-         set_CS1_0;
-      }
+      /* The last compare of a long delay is kept far enough from the one before */
+      uint16_t chunk;
+      
+      if (schedule_ticks_left >= 2UL * SCHEDULE_CHUNK_TICKS)
+         chunk = SCHEDULE_CHUNK_TICKS;
+      else if (schedule_ticks_left > SCHEDULE_CHUNK_TICKS)
+         chunk = schedule_ticks_left / 2;
+      else
+         chunk = schedule_ticks_left;
+      
+      schedule_ticks_left -= chunk;
+      TCD1.CCA = from + chunk;
       
-      /* Start timer with 350 us */
-      timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV64, 175, INT_LEVEL_LOW);
+      /* A compare the count already passed would only match after the timer wraps, so it is taken as reached */
+      if ((uint16_t)(TCD1.CNT - from) < chunk)
+         break;
+      
+      TCD1.INTFLAGS = TC1_CCAIF_bm;
+      from += chunk;
    }
    
-   update_pots_on_port0();
-   update_pots_on_port1();
+   if (played && (app_regs.REG_EVNT_ENABLE & B_EVT_DO_OUT))
+   {
+      core_func_send_event(ADD_REG_DO_OUT, true);
+   }
+   
+   if (app_regs.REG_DO_SCHEDULE_START == GM_SCHEDULE_STOP && (app_regs.REG_EVNT_ENABLE & B_EVT_DO_SCHEDULE))
+   {
+      core_func_send_event(ADD_REG_DO_SCHEDULE_START, true);
+   }
 }
 
-/************************************************************************/
-/* Callbacks: cloc control                                              */
-/************************************************************************/
-void core_callback_clock_to_repeater(void) {}
-void core_callback_clock_to_generator(void) {}
-void core_callback_clock_to_unlock(void) {}
-void core_callback_clock_to_lock(void) {}
+/* The first entry is played its own delay plus delay_us from now */
+void start_do_schedule(uint32_t delay_us)
+{
+   if (app_regs.REG_DO_SCHEDULE_LENGTH == 0)
+   {
+      stop_do_schedule();
+      return;
+   }
+   
+   app_regs.REG_DO_SCHEDULE_START = GM_SCHEDULE_NOW;
+   
+   schedule_index = 0;
+   schedule_ticks_left = (delay_us + app_regs.REG_DO_SCHEDULE[0]) * SAMPLE_TIMER_TICKS_PER_US;
+   
+   /* The compare flag was set on each pass of the free running timer. It is cleared, with */
+   /* the compare a whole wrap away, before the first entry is armed, so its match is kept */
+   uint16_t from = TCD1.CNT;
+   
+   TCD1.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+   TCD1.CCA = from - 1;
+   TCD1.INTFLAGS = TC1_CCAIF_bm;
+   
+   advance_do_schedule(from);
+   
+   if (app_regs.REG_DO_SCHEDULE_START != GM_SCHEDULE_STOP)
+   {
+      TCD1.INTCTRLB = TC_CCAINTLVL_LO_gc;
+   }
+}
+
+/* Called every ms, TCD1 times the last 2 ms before REG_DO_SCHEDULE_START_TIME */
+void check_do_schedule_start_time(void)
+{
+   if (app_regs.REG_DO_SCHEDULE_START != GM_SCHEDULE_AT_TIME)
+      return;
+   
+   uint32_t second = core_func_read_R_TIMESTAMP_SECOND();
+   uint32_t start_second = app_regs.REG_DO_SCHEDULE_START_TIME[0];
+   
+   if (start_second > second + 1)
+      return;
+   
+   /* A time already gone starts the schedule at once, however long ago it was */
+   if (start_second < second)
+   {
+      start_do_schedule(0);
+      return;
+   }
+   
+   /* Timestamp's microseconds are counted in steps of 32 us */
+   int32_t left_us = (int32_t)(start_second - second) * 1000000L
+                   + (int32_t)app_regs.REG_DO_SCHEDULE_START_TIME[1]
+                   - (int32_t)core_func_read_R_TIMESTAMP_MICRO() * 32;
+   
+   if (left_us > 2000)
+      return;
+   
+   start_do_schedule(left_us > 0 ? left_us : 0);
+}
 
-/************************************************************************/
-/* Callbacks: uart control                                              */
-/************************************************************************/
-void core_callback_uart_rx_before_exec(void) {}
-void core_callback_uart_rx_after_exec(void) {}
-void core_callback_uart_tx_before_exec(void) {}
-void core_callback_uart_tx_after_exec(void) {}
-void core_callback_uart_cts_before_exec(void) {}
-void core_callback_uart_cts_after_exec(void) {}
 
 /************************************************************************/
-/* Callbacks: Read app register                                         */
+/* Process Thresholds                                                   */
 /************************************************************************/
-bool core_read_app_register(uint8_t add, uint8_t type)
+typedef struct
 {
-	/* Check if it will not access forbidden memory */
-	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
-		return false;
-	
-	/* Check if type matches */
-	if (app_regs_type[add-APP_REGS_ADD_MIN] != type)
-		return false;
-	
-	/* Receive data */
-	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+   uint16_t up_counter;       // Consecutive samples on the active side of the threshold
+   uint16_t down_counter;     // Consecutive samples on the inactive side of the threshold
+   uint16_t up_samples;       // REG_DOx_TH_UP_MS converted to samples
+   uint16_t down_samples;     // REG_DOx_TH_DOWN_MS converted to samples
+   bool is_active;            // Comparator output on the last sample, for the hysteresis
+   int16_t history[SLOPE_SAMPLES_MAX];    // Last inputs, for the slope
+   uint8_t history_index;
+   uint8_t history_channel;   // Input the history belongs to, SLOPE_NOT_PRIMED after a change of settings
+} threshold_t;
 
-	/* Return success */
-	return true;
+#define SLOPE_NOT_PRIMED 0xFF
+
+threshold_t thresholds[8];
+
+void reset_slopes(void)
+{
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      thresholds[i].history_channel = SLOPE_NOT_PRIMED;
+   }
 }
 
-/************************************************************************/
-/* Callbacks: Write app register                                        */
-/************************************************************************/
-bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint16_t n_elements)
+/* Change of the input over the last REG_DO_TH_SLOPE_SAMPLES samples */
+int32_t update_slope(threshold_t * th, uint8_t channel, int16_t value, uint8_t samples)
 {
-	/* Check if it will not access forbidden memory */
-	if (add < APP_REGS_ADD_MIN || add > APP_REGS_ADD_MAX)
-		return false;
-	
-	/* Check if type matches */
-	if (app_regs_type[add-APP_REGS_ADD_MIN] != type)
-		return false;
+   /* A new input starts flat instead of jumping from the old one */
+   if (th->history_channel != channel)
+   {
+      for (uint8_t j = 0; j < samples; j++)
+      {
+         th->history[j] = value;
+      }
+      
+      th->history_index = 0;
+      th->history_channel = channel;
+   }
+   
+   int32_t slope = (int32_t)value - th->history[th->history_index];
+   
+   th->history[th->history_index] = value;
+   
+   if (++th->history_index >= samples)
+      th->history_index = 0;
+   
+   return slope;
+}
 
-	/* Check if the number of elements matches */
-	if (app_regs_n_elements[add-APP_REGS_ADD_MIN] != n_elements)
-		return false;
+uint16_t ms_to_samples(uint16_t ms)
+{
+   /* The thresholds run at the reported rate, unless they see every sample */
+   uint32_t period = 1000UL;
+   
+   if (app_regs.REG_THRESHOLDS_MODE == GM_THRESHOLDS_DECIMATED)
+      period <<= app_regs.REG_DECIMATION;
+   
+   /* Round up so the output never changes before the configured time */
+   uint32_t samples = ((uint32_t)ms * sample_rate_hz[app_regs.REG_SAMPLE_RATE] + period - 1) / period;
+   
+   return (samples > 65534) ? 65534 : samples;
+}
 
-	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+void update_threshold_durations(void)
+{
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      thresholds[i].up_samples = ms_to_samples(*((&app_regs.REG_DO0_TH_UP_MS)+i));
+      thresholds[i].down_samples = ms_to_samples(*((&app_regs.REG_DO0_TH_DOWN_MS)+i));
+   }
 }
 
-/************************************************************************/
-/* Process Thresholds                                                   */
-/************************************************************************/
-uint16_t ch0_up_counter = 0;
-uint16_t ch1_up_counter = 0;
-uint16_t ch2_up_counter = 0;
-uint16_t ch3_up_counter = 0;
-uint16_t ch4_up_counter = 0;
-uint16_t ch5_up_counter = 0;
-uint16_t ch6_up_counter = 0;
-uint16_t ch7_up_counter = 0;
-uint16_t ch0_down_counter = 0;
-uint16_t ch1_down_counter = 0;
-uint16_t ch2_down_counter = 0;
-uint16_t ch3_down_counter = 0;
-uint16_t ch4_down_counter = 0;
-uint16_t ch5_down_counter = 0;
-uint16_t ch6_down_counter = 0;
-uint16_t ch7_down_counter = 0;
-
-void process_thresholds(void)
+void process_thresholds(int16_t * values)
 {
+   uint16_t start = TCC0.CNT;
+   
    uint16_t do_set = 0;
    uint16_t do_clr = 0;
    
-   int16_t output_thresholds[8];
+   threshold_t * th = thresholds;
    
+   int16_t virtual_values[VIRTUAL_N_CHANNELS];
+   bool virtual_values_are_ready = false;
    
-   /* Map load cell values into threshold comparison */
-   for (uint8_t i = 0; i < 8; i++)
+   uint8_t comparators = 0;      // Comparators active on this sample
+   
+   /* Compare each output's input first, the outputs may combine them */
+   for (uint8_t i = 0; i < 8; i++, th++)
    {
-      switch (*((&app_regs.REG_DO0_CH)+i))
+      uint8_t channel = *((&app_regs.REG_DO0_CH)+i);
+      
+      if (channel == GM_SOFTWARE)
+         continue;
+      
+      int16_t value;
+      
+      if (channel < GM_SOFTWARE)
       {
-         case GM_CH0: output_thresholds[i] = app_regs.REG_LOAD_CELLS[0]; break;
-         case GM_CH1: output_thresholds[i] = app_regs.REG_LOAD_CELLS[1]; break;
-         case GM_CH2: output_thresholds[i] = app_regs.REG_LOAD_CELLS[2]; break;
-         case GM_CH3: output_thresholds[i] = app_regs.REG_LOAD_CELLS[3]; break;
-         case GM_CH4: output_thresholds[i] = app_regs.REG_LOAD_CELLS[4]; break;
-         case GM_CH5: output_thresholds[i] = app_regs.REG_LOAD_CELLS[5]; break;
-         case GM_CH6: output_thresholds[i] = app_regs.REG_LOAD_CELLS[6]; break;
-         case GM_CH7: output_thresholds[i] = app_regs.REG_LOAD_CELLS[7]; break;
+         value = values[channel];
       }
-   }
-   
-   
-	/* Output channel 1 */
-	if (app_regs.REG_DO0_CH != GM_SOFTWARE)
-	{
-		if(!(app_regs.REG_DOS_TH_INV & B_TH_DO1)){ 
-			if (output_thresholds[0] >= app_regs.REG_DO0_TH_VALUE)
-			{
-				if (++ch0_up_counter == app_regs.REG_DO0_TH_UP_MS + 1)
-				do_set |= (1<<(0));
-				if (ch0_up_counter > app_regs.REG_DO0_TH_UP_MS)
-				ch0_up_counter--;
+      else
+      {
+         /* Computed once, for the first output that needs them */
+         if (!virtual_values_are_ready)
+         {
+            compute_virtual_channels(values, virtual_values);
+            virtual_values_are_ready = true;
+         }
+         
+         value = virtual_values[channel - GM_VIRTUAL0];
+      }
+      
+      int16_t th_value = *((&app_regs.REG_DO0_TH_VALUE)+i);
+      int16_t th_low = app_regs.REG_DO_TH_LOW_VALUE[i];
+      bool inverted = (app_regs.REG_DOS_TH_INV & (1<<i)) ? true : false;
+      bool active;
+      
+      switch (app_regs.REG_DO_TH_COMPARATOR[i])
+      {
+         /* Between the two thresholds the comparator keeps its last state */
+         /* When inverted, it becomes active at the low threshold and is released above the high one */
+         case GM_COMPARATOR_HYSTERESIS:
+            if (inverted)
+               active = th->is_active ? (value <= th_value) : (value <= th_low);
+            else
+               active = th->is_active ? (value >= th_low) : (value >= th_value);
+            break;
          
-				ch0_down_counter = 0;
-			}
-			else
-			{
-				if (++ch0_down_counter == app_regs.REG_DO0_TH_DOWN_MS + 1)
-				do_clr |= (1<<(0));
-				if (ch0_down_counter > app_regs.REG_DO0_TH_DOWN_MS)
-				ch0_down_counter--;
+         /* Inverting a window gives the other one */
+         case GM_COMPARATOR_WINDOW:
+            active = ((value >= th_low && value <= th_value) != inverted);
+            break;
          
-				ch0_up_counter = 0;
-			}
-		}
-		else{
-			if (output_thresholds[0] <= app_regs.REG_DO0_TH_VALUE)
-			{
-				if (++ch0_up_counter == app_regs.REG_DO0_TH_UP_MS + 1)
-				do_set |= (1<<(0));
-				if (ch0_up_counter > app_regs.REG_DO0_TH_UP_MS)
-				ch0_up_counter--;
-				
-				ch0_down_counter = 0;
-				}
-			else
-			{
-				if (++ch0_down_counter == app_regs.REG_DO0_TH_DOWN_MS + 1)
-				do_clr |= (1<<(0));
-				if (ch0_down_counter > app_regs.REG_DO0_TH_DOWN_MS)
-				ch0_down_counter--;
-					
-				ch0_up_counter = 0;
-			}
-		}
-   
-   }
-   
-   /* Output channel 2 */
-   if (app_regs.REG_DO1_CH != GM_SOFTWARE)
-   {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO2)){ 
-		  if (output_thresholds[1] >= app_regs.REG_DO1_TH_VALUE)
-		  {
-			 if (++ch1_up_counter == app_regs.REG_DO1_TH_UP_MS + 1)
-			 do_set |= (1<<(1));
-			 if (ch1_up_counter > app_regs.REG_DO1_TH_UP_MS)
-			 ch1_up_counter--;
+         case GM_COMPARATOR_OUT_OF_WINDOW:
+            active = ((value >= th_low && value <= th_value) == inverted);
+            break;
          
-			 ch1_down_counter = 0;
-		  }
-		  else
-		  {
-			 if (++ch1_down_counter == app_regs.REG_DO1_TH_DOWN_MS + 1)
-			 do_clr |= (1<<(1));
-			 if (ch1_down_counter > app_regs.REG_DO1_TH_DOWN_MS)
-			 ch1_down_counter--;
+         /* When inverted, the output is set when the input falls at least as fast as the threshold */
+         case GM_COMPARATOR_SLOPE:
+         {
+            int32_t slope = update_slope(th, channel, value, app_regs.REG_DO_TH_SLOPE_SAMPLES[i]);
+            active = inverted ? (slope <= th_value) : (slope >= th_value);
+            break;
+         }
          
-			 ch1_up_counter = 0;
-		  }
-	  }
-	  else{
-	  	  if (output_thresholds[1] <= app_regs.REG_DO1_TH_VALUE)
-	  	  {
-		  	  if (++ch1_up_counter == app_regs.REG_DO1_TH_UP_MS + 1)
-		  	  do_set |= (1<<(1));
-		  	  if (ch1_up_counter > app_regs.REG_DO1_TH_UP_MS)
-		  	  ch1_up_counter--;
-		  	  
-		  	  ch1_down_counter = 0;
-	  	  }
-	  	  else
-	  	  {
-		  	  if (++ch1_down_counter == app_regs.REG_DO1_TH_DOWN_MS + 1)
-		  	  do_clr |= (1<<(1));
-		  	  if (ch1_down_counter > app_regs.REG_DO1_TH_DOWN_MS)
-		  	  ch1_down_counter--;
-		  	  
-		  	  ch1_up_counter = 0;
-	  	  }	  
-	  }
-	}
+         /* When inverted, the output is set below the threshold */
+         default:
+            active = inverted ? (value <= th_value) : (value >= th_value);
+            break;
+      }
+      
+      th->is_active = active;
+      
+      if (active)
+         comparators |= (1<<i);
+   }
    
-   /* Output channel 3 */
-   if (app_regs.REG_DO2_CH != GM_SOFTWARE)
+   th = thresholds;
+   
+   for (uint8_t i = 0; i < 8; i++, th++)
    {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO3)){ 
-		  if (output_thresholds[2] >= app_regs.REG_DO2_TH_VALUE)
-		  {
-			 if (++ch2_up_counter == app_regs.REG_DO2_TH_UP_MS + 1)
-			 do_set |= (1<<(2));
-			 if (ch2_up_counter > app_regs.REG_DO2_TH_UP_MS)
-			 ch2_up_counter--;
+      uint8_t inputs = app_regs.REG_DO_LOGIC_INPUTS[i] & comparators;
+      bool active;
+      
+      switch (app_regs.REG_DO_LOGIC[i])
+      {
+         /* Active when all the selected comparators are, none selected leaves it inactive */
+         case GM_LOGIC_AND:
+            active = (app_regs.REG_DO_LOGIC_INPUTS[i] && inputs == app_regs.REG_DO_LOGIC_INPUTS[i]);
+            break;
          
-			 ch2_down_counter = 0;
-		  }
-		  else
-		  {
-			 if (++ch2_down_counter == app_regs.REG_DO2_TH_DOWN_MS + 1)
-			 do_clr |= (1<<(2));
-			 if (ch2_down_counter > app_regs.REG_DO2_TH_DOWN_MS)
-			 ch2_down_counter--;
+         case GM_LOGIC_OR:
+            active = (inputs != 0);
+            break;
          
-			 ch2_up_counter = 0;
-		  }
-	   }
-	   else{
-	   	  if (output_thresholds[2] <= app_regs.REG_DO2_TH_VALUE)
-	   	  {
-		   	  if (++ch2_up_counter == app_regs.REG_DO2_TH_UP_MS + 1)
-		   	  do_set |= (1<<(2));
-		   	  if (ch2_up_counter > app_regs.REG_DO2_TH_UP_MS)
-		   	  ch2_up_counter--;
-		   	  
-		   	  ch2_down_counter = 0;
-	   	  }
-	   	  else
-	   	  {
-		   	  if (++ch2_down_counter == app_regs.REG_DO2_TH_DOWN_MS + 1)
-		   	  do_clr |= (1<<(2));
-		   	  if (ch2_down_counter > app_regs.REG_DO2_TH_DOWN_MS)
-		   	  ch2_down_counter--;
-		   	  
-		   	  ch2_up_counter = 0;
-	   	  }
-   	  }	   
-    }
-		   
-   
-   /* Output channel 4 */
-   if (app_regs.REG_DO3_CH != GM_SOFTWARE)
-   {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO4)){ 
-		  if (output_thresholds[3] >= app_regs.REG_DO3_TH_VALUE)
-		  {
-			  if (++ch3_up_counter == app_regs.REG_DO3_TH_UP_MS + 1)
-			  do_set |= (1<<(3));
-			  if (ch3_up_counter > app_regs.REG_DO3_TH_UP_MS)
-			  ch3_up_counter--;
-			  
-			  ch3_down_counter = 0;
-		  }
-		  else
-		  {
-			  if (++ch3_down_counter == app_regs.REG_DO3_TH_DOWN_MS + 1)
-			  do_clr |= (1<<(3));
-			  if (ch3_down_counter > app_regs.REG_DO3_TH_DOWN_MS)
-			  ch3_down_counter--;
-			  
-			  ch3_up_counter = 0;
-		  }
-	  }
-	  else{
-		  if (output_thresholds[3] <= app_regs.REG_DO3_TH_VALUE)
-		  {
-			  if (++ch3_up_counter == app_regs.REG_DO3_TH_UP_MS + 1)
-			  do_set |= (1<<(3));
-			  if (ch3_up_counter > app_regs.REG_DO3_TH_UP_MS)
-			  ch3_up_counter--;
-			  
-			  ch3_down_counter = 0;
-		  }
-		  else
-		  {
-			  if (++ch3_down_counter == app_regs.REG_DO3_TH_DOWN_MS + 1)
-			  do_clr |= (1<<(3));
-			  if (ch3_down_counter > app_regs.REG_DO3_TH_DOWN_MS)
-			  ch3_down_counter--;
-			  
-			  ch3_up_counter = 0;
-		  }
-	  }
-   }
-		  
-   
-   /* Output channel 5 */
-   if (app_regs.REG_DO4_CH != GM_SOFTWARE)
-   {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO5)){ 
-		  if (output_thresholds[4] >= app_regs.REG_DO4_TH_VALUE)
-		  {
-			  if (++ch4_up_counter == app_regs.REG_DO4_TH_UP_MS + 1)
-			  do_set |= (1<<(4));
-			  if (ch4_up_counter > app_regs.REG_DO4_TH_UP_MS)
-			  ch4_up_counter--;
-			  
-			  ch4_down_counter = 0;
-		  }
-		  else
-		  {
-			  if (++ch4_down_counter == app_regs.REG_DO4_TH_DOWN_MS + 1)
-			  do_clr |= (1<<(4));
-			  if (ch4_down_counter > app_regs.REG_DO4_TH_DOWN_MS)
-			  ch4_down_counter--;
-			  
-			  ch4_up_counter = 0;
-		  }
-	  }
-      else{
-        if (output_thresholds[4] <= app_regs.REG_DO4_TH_VALUE)
-        {
-	        if (++ch4_up_counter == app_regs.REG_DO4_TH_UP_MS + 1)
-	        do_set |= (1<<(4));
-	        if (ch4_up_counter > app_regs.REG_DO4_TH_UP_MS)
-	        ch4_up_counter--;
-	        
-	        ch4_down_counter = 0;
-        }
-        else
-        {
-	        if (++ch4_down_counter == app_regs.REG_DO4_TH_DOWN_MS + 1)
-	        do_clr |= (1<<(4));
-	        if (ch4_down_counter > app_regs.REG_DO4_TH_DOWN_MS)
-	        ch4_down_counter--;
-	        
-	        ch4_up_counter = 0;
-        }
-     }
-   }
-	  
-	  
-   /* Output channel 6 */
-   if (app_regs.REG_DO5_CH != GM_SOFTWARE)
-   {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO6)){ 
-		  if (output_thresholds[5] >= app_regs.REG_DO5_TH_VALUE)
-		  {
-			  if (++ch5_up_counter == app_regs.REG_DO5_TH_UP_MS + 1)
-			  do_set |= (1<<(5));
-			  if (ch5_up_counter > app_regs.REG_DO5_TH_UP_MS)
-			  ch5_up_counter--;
-			  
-			  ch5_down_counter = 0;
-		  }
-		  else
-		  {
-			  if (++ch5_down_counter == app_regs.REG_DO5_TH_DOWN_MS + 1)
-			  do_clr |= (1<<(5));
-			  if (ch5_down_counter > app_regs.REG_DO5_TH_DOWN_MS)
-			  ch5_down_counter--;
-			  
-			  ch5_up_counter = 0;
-		  }
-	  }
-	  else{
-		  if (output_thresholds[5] <= app_regs.REG_DO5_TH_VALUE)
-		  {
-			  if (++ch5_up_counter == app_regs.REG_DO5_TH_UP_MS + 1)
-			  do_set |= (1<<(5));
-			  if (ch5_up_counter > app_regs.REG_DO5_TH_UP_MS)
-			  ch5_up_counter--;
-			  
-			  ch5_down_counter = 0;
-		  }
-		  else
-		  {
-			  if (++ch5_down_counter == app_regs.REG_DO5_TH_DOWN_MS + 1)
-			  do_clr |= (1<<(5));
-			  if (ch5_down_counter > app_regs.REG_DO5_TH_DOWN_MS)
-			  ch5_down_counter--;
-			  
-			  ch5_up_counter = 0;
-		  }
-	  }
-   }
-   
-   /* Output channel 7 */
-   if (app_regs.REG_DO6_CH != GM_SOFTWARE)
-   {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO7)){ 
-		  if (output_thresholds[6] >= app_regs.REG_DO6_TH_VALUE)
-		  {
-			 if (++ch6_up_counter == app_regs.REG_DO6_TH_UP_MS + 1)
-			 do_set |= (1<<(6));
-			 if (ch6_up_counter > app_regs.REG_DO6_TH_UP_MS)
-			 ch6_up_counter--;
+         /* Active when an odd number of the selected comparators are */
+         case GM_LOGIC_XOR:
+            inputs ^= inputs >> 4;
+            inputs ^= inputs >> 2;
+            inputs ^= inputs >> 1;
+            active = (inputs & 1);
+            break;
          
-			 ch6_down_counter = 0;
-		  }
-		  else
-		  {
-			 if (++ch6_down_counter == app_regs.REG_DO6_TH_DOWN_MS + 1)
-			 do_clr |= (1<<(6));
-			 if (ch6_down_counter > app_regs.REG_DO6_TH_DOWN_MS)
-			 ch6_down_counter--;
+         /* The comparator is only an input of other outputs */
+         case GM_LOGIC_DISABLED:
+            continue;
          
-			 ch6_up_counter = 0;
-		  }
-	   }
-	   else{ 
-		  if (output_thresholds[6] <= app_regs.REG_DO6_TH_VALUE)
-		  {
-			  if (++ch6_up_counter == app_regs.REG_DO6_TH_UP_MS + 1)
-			  do_set |= (1<<(6));
-			  if (ch6_up_counter > app_regs.REG_DO6_TH_UP_MS)
-			  ch6_up_counter--;
-			  
-			  ch6_down_counter = 0;
-		  }
-		  else
-		  {
-			  if (++ch6_down_counter == app_regs.REG_DO6_TH_DOWN_MS + 1)
-			  do_clr |= (1<<(6));
-			  if (ch6_down_counter > app_regs.REG_DO6_TH_DOWN_MS)
-			  ch6_down_counter--;
-			  
-			  ch6_up_counter = 0;
-		  }
-	  }
-   }
-	     
-   
-   /* Output channel 8 */
-   if (app_regs.REG_DO7_CH != GM_SOFTWARE)
-   {
-      if(!(app_regs.REG_DOS_TH_INV & B_TH_DO8)){ 
-		  if (output_thresholds[7] >= app_regs.REG_DO7_TH_VALUE)
-		  {
-			 if (++ch7_up_counter == app_regs.REG_DO7_TH_UP_MS + 1)
-			 do_set |= (1<<(7));
-			 if (ch7_up_counter > app_regs.REG_DO7_TH_UP_MS)
-			 ch7_up_counter--;
+         default:
+            if (*((&app_regs.REG_DO0_CH)+i) == GM_SOFTWARE)
+               continue;
+            
+            active = (comparators & (1<<i)) ? true : false;
+            break;
+      }
+      
+      /* The output is driven once the counter saturates at the configured duration */
+      if (active)
+      {
+         if (th->up_counter < th->up_samples)
+            th->up_counter++;
+         else
+            do_set |= (1<<i);
          
-			 ch7_down_counter = 0;
-		  }
-		  else
-		  {
-			 if (++ch7_down_counter == app_regs.REG_DO7_TH_DOWN_MS + 1)
-			 do_clr |= (1<<(7));
-			 if (ch7_down_counter > app_regs.REG_DO7_TH_DOWN_MS)
-			 ch7_down_counter--;
+         th->down_counter = 0;
+      }
+      else
+      {
+         if (th->down_counter < th->down_samples)
+            th->down_counter++;
+         else
+            do_clr |= (1<<i);
          
-			 ch7_up_counter = 0;
-		  }
-	  }
-	  else{
-          if (output_thresholds[7] <= app_regs.REG_DO7_TH_VALUE)
-          {
-	          if (++ch7_up_counter == app_regs.REG_DO7_TH_UP_MS + 1)
-	          do_set |= (1<<(7));
-	          if (ch7_up_counter > app_regs.REG_DO7_TH_UP_MS)
-	          ch7_up_counter--;
-	          
-	          ch7_down_counter = 0;
-          }
-          else
-          {
-	          if (++ch7_down_counter == app_regs.REG_DO7_TH_DOWN_MS + 1)
-	          do_clr |= (1<<(7));
-	          if (ch7_down_counter > app_regs.REG_DO7_TH_DOWN_MS)
-	          ch7_down_counter--;
-	          
-	          ch7_up_counter = 0;
-          }
-       }   
-	}
+         th->up_counter = 0;
+      }
+   }
+   
+   /* The pulsed outputs only react to the threshold being crossed */
+   uint8_t pulsed = pulsed_outputs;
+   uint8_t crossed = do_set & ~thresholds_latched & pulsed & ~pulse_trains_running;
+   
+   if (crossed)
+      crossed &= ~pulse_trains_requested();
+   
+   thresholds_latched = (thresholds_latched | do_set) & ~do_clr;
+   
+   if (pulsed)
+   {
+      do_set = (do_set & ~pulsed) | crossed;
+      do_clr &= ~pulsed;
+   }
    
    /* Send Event */
    bool send_event = false;
@@ -943,11 +1898,158 @@ void process_thresholds(void)
       app_write_REG_DO_CLEAR(&do_clr);
       send_event = true;
    }
+   if (crossed)
+   {
+      start_pulse_trains(crossed);
+   }
    if(send_event)
    {
+      /* TCC0 has been counting since the conversion of this sample started */
+      app_regs.REG_THRESHOLDS_LATENCY = TCC0.CNT / SAMPLE_TIMER_TICKS_PER_US;
+      
       if (app_regs.REG_EVNT_ENABLE & B_EVT_DO_OUT)
       {
          core_func_send_event(ADD_REG_DO_OUT, true);
       }
    }
-}   
\ No newline at end of file
+   
+   perf_keep_max_cycles(PERF_THRESHOLDS_MAX_CYCLES, sample_timer_elapsed(start));
+}   
+
+
+/************************************************************************/
+/* DI0 edges                                                            */
+/************************************************************************/
+/* PB0 senses both edges, and each edge is routed through the event     */
+/* channel 0 to a capture of TCE0. The capture dates the edge to 0.25   */
+/* us whatever the latency of the interrupt, and the 2 captures of      */
+/* the hardware plus the queue hold the edges that come closer than     */
+/* the events can be sent. Only the 500 us tick sends them, so the      */
+/* user timestamp is never swapped under the readout's LOAD_CELLS event */
+#define DI0_EDGES_QUEUE_SIZE 16     // Power of 2
+
+typedef struct
+{
+   uint8_t level;
+   uint16_t capture;
+   uint32_t second;
+   uint16_t usecond;
+} di0_edge_t;
+
+di0_edge_t di0_edges[DI0_EDGES_QUEUE_SIZE];
+uint8_t di0_edges_head = 0;
+uint8_t di0_edges_tail = 0;
+uint8_t di0_level = 0;      // Level after the last edge captured
+
+void initialize_di0_capture(void)
+{
+   EVSYS.CH0MUX = EVSYS_CHMUX_PORTB_PIN0_gc;
+   EVSYS.CH0CTRL = EVSYS_DIGFILT_4SAMPLES_gc;
+   
+   TCE0.CTRLA = TC_CLKSEL_OFF_gc;
+   TCE0.CTRLFSET = TC_CMD_RESET_gc;
+   TCE0.CTRLB = TC_WGMODE_NORMAL_gc;
+   TCE0.CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH0_gc;
+   TCE0.PER = 0xFFFF;
+   TCE0.CTRLA = TC_CLKSEL_DIV8_gc;
+}
+
+/* The edges are captured while their event is enabled */
+void update_di0_capture(void)
+{
+   bool enable = (app_regs.REG_EVNT_ENABLE & B_EVT_DI0_EDGE) ? true : false;
+   
+   if (enable == ((TCE0.CTRLB & TC0_CCAEN_bm) ? true : false))
+      return;
+   
+   if (enable)
+   {
+      /* Edges alternate, so the level is only read when starting */
+      di0_level = read_DI0 ? 1 : 0;
+      di0_edges_head = 0;
+      di0_edges_tail = 0;
+      
+      TCE0.CTRLB |= TC0_CCAEN_bm;
+      TCE0.INTFLAGS = TC0_CCAIF_bm | TC0_ERRIF_bm;
+      TCE0.INTCTRLB = TC_CCAINTLVL_LO_gc;
+   }
+   else
+   {
+      TCE0.INTCTRLB = TC_CCAINTLVL_OFF_gc;
+      TCE0.CTRLB &= ~TC0_CCAEN_bm;
+   }
+}
+
+/* Called with each capture, the edges are queued with their Harp time */
+void queue_di0_edge(uint16_t capture)
+{
+   uint32_t second;
+   uint16_t usecond;
+   uint16_t ticks_since_edge = TCE0.CNT - capture;
+   
+   /* The core can start a new second between the two reads */
+   do {
+      second = core_func_read_R_TIMESTAMP_SECOND();
+      usecond = core_func_read_R_TIMESTAMP_MICRO();
+   } while (second != core_func_read_R_TIMESTAMP_SECOND());
+   
+   /* Timestamp's microseconds are counted in steps of 32 us */
+   uint16_t elapsed = (ticks_since_edge + 16 * SAMPLE_TIMER_TICKS_PER_US) / (32 * SAMPLE_TIMER_TICKS_PER_US);
+   
+   if (usecond < elapsed)
+   {
+      second--;
+      usecond += 31250;
+   }
+   
+   di0_level ^= 1;
+   
+   /* Edges were lost, so the level of the ones that follow is read again */
+   if (TCE0.INTFLAGS & TC0_ERRIF_bm)
+   {
+      TCE0.INTFLAGS = TC0_ERRIF_bm;
+      app_regs.REG_PERF_COUNTERS[PERF_DI0_EDGES_DROPPED]++;
+      di0_level = read_DI0 ? 1 : 0;
+   }
+   
+   uint8_t next = (di0_edges_head + 1) & (DI0_EDGES_QUEUE_SIZE - 1);
+   
+   if (next == di0_edges_tail)
+   {
+      app_regs.REG_PERF_COUNTERS[PERF_DI0_EDGES_DROPPED]++;
+      return;
+   }
+   
+   di0_edges[di0_edges_head].level = di0_level;
+   di0_edges[di0_edges_head].capture = capture;
+   di0_edges[di0_edges_head].second = second;
+   di0_edges[di0_edges_head].usecond = usecond - elapsed;
+   di0_edges_head = next;
+}
+
+/* Sends the queued edges in order, the ones without room in the TX buffer wait for the next tick */
+void send_di0_edges(void)
+{
+   if (di0_edges_head == di0_edges_tail)
+      return;
+   
+   /* The user timestamp may still be waiting for the LOAD_CELLS event of the window */
+   uint32_t second;
+   uint16_t usecond;
+   core_func_read_user_timestamp(&second, &usecond);
+   
+   while (di0_edges_head != di0_edges_tail && tx_buffer_bytes_with(ADD_REG_DI0_EDGE) < HWBP_UART_TXBUFSIZ)
+   {
+      di0_edge_t * edge = &di0_edges[di0_edges_tail];
+      
+      app_regs.REG_DI0_EDGE[0] = edge->level;
+      app_regs.REG_DI0_EDGE[1] = edge->capture;
+      
+      core_func_update_user_timestamp(edge->second, edge->usecond);
+      core_func_send_event(ADD_REG_DI0_EDGE, false);
+      
+      di0_edges_tail = (di0_edges_tail + 1) & (DI0_EDGES_QUEUE_SIZE - 1);
+   }
+   
+   core_func_update_user_timestamp(second, usecond);
+}
\ No newline at end of file
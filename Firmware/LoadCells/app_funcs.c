@@ -2,9 +2,24 @@
 #include "app_ios_and_regs.h"
 #include "hwbp_core.h"
 
-extern void update_offsets (uint8_t load_cell_channel);
+extern void update_sample_rate (void);
+extern void update_threshold_durations (void);
+extern void reset_decimation (void);
+extern void update_load_cells_payload (void);
+extern void start_auto_zero (uint8_t channels);
+extern void reset_delta_reference (void);
+extern void update_deadband_heartbeat (void);
+extern void reset_filter (void);
+extern void update_virtual_channel_inputs (void);
+extern void reset_slopes (void);
+extern void update_pulsed_outputs (void);
+extern void start_do_schedule (uint32_t delay_us);
+extern void stop_do_schedule (void);
+extern void update_di0_capture (void);
 
 extern uint16_t pulse_counter_ms;
+extern uint8_t offsets_pending[];
+extern uint8_t batch_counter;
 
 /************************************************************************/
 /* Create pointers to functions                                         */
@@ -70,7 +85,41 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_DO5_TH_DOWN_MS,
 	&app_read_REG_DO6_TH_DOWN_MS,
 	&app_read_REG_DO7_TH_DOWN_MS,
-	&app_read_REG_EVNT_ENABLE
+	&app_read_REG_EVNT_ENABLE,
+	&app_read_REG_SAMPLE_RATE,
+	&app_read_REG_DECIMATION,
+	&app_read_REG_LOAD_CELLS_BATCH,
+	&app_read_REG_BATCH_SIZE,
+	&app_read_REG_PORTS_ENABLE,
+	&app_read_REG_THRESHOLDS_MODE,
+	&app_read_REG_THRESHOLDS_LATENCY,
+	&app_read_REG_AUTO_ZERO,
+	&app_read_REG_PERF_COUNTERS,
+	&app_read_REG_SEQUENCE_ENABLE,
+	&app_read_REG_DELTA_KEYFRAME_INTERVAL,
+	&app_read_REG_LOAD_CELLS_DELTA,
+	&app_read_REG_DEADBAND,
+	&app_read_REG_DEADBAND_HEARTBEAT_MS,
+	&app_read_REG_FILTER_MODE,
+	&app_read_REG_FILTER_LENGTH,
+	&app_read_REG_FILTER_CHANNELS,
+	&app_read_REG_FILTER_TARGETS,
+	&app_read_REG_VIRTUAL_WEIGHTS,
+	&app_read_REG_VIRTUAL_SHIFT,
+	&app_read_REG_LOAD_CELLS_VIRTUAL,
+	&app_read_REG_DO_TH_COMPARATOR,
+	&app_read_REG_DO_TH_LOW_VALUE,
+	&app_read_REG_DO_TH_SLOPE_SAMPLES,
+	&app_read_REG_DO_LOGIC,
+	&app_read_REG_DO_LOGIC_INPUTS,
+	&app_read_REG_DO_PULSE_WIDTH_MS,
+	&app_read_REG_DO_PULSE_PERIOD_MS,
+	&app_read_REG_DO_PULSE_COUNT,
+	&app_read_REG_DO_SCHEDULE,
+	&app_read_REG_DO_SCHEDULE_LENGTH,
+	&app_read_REG_DO_SCHEDULE_START_TIME,
+	&app_read_REG_DO_SCHEDULE_START,
+	&app_read_REG_DI0_EDGE
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -132,7 +181,41 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_DO5_TH_DOWN_MS,
 	&app_write_REG_DO6_TH_DOWN_MS,
 	&app_write_REG_DO7_TH_DOWN_MS,
-	&app_write_REG_EVNT_ENABLE
+	&app_write_REG_EVNT_ENABLE,
+	&app_write_REG_SAMPLE_RATE,
+	&app_write_REG_DECIMATION,
+	&app_write_REG_LOAD_CELLS_BATCH,
+	&app_write_REG_BATCH_SIZE,
+	&app_write_REG_PORTS_ENABLE,
+	&app_write_REG_THRESHOLDS_MODE,
+	&app_write_REG_THRESHOLDS_LATENCY,
+	&app_write_REG_AUTO_ZERO,
+	&app_write_REG_PERF_COUNTERS,
+	&app_write_REG_SEQUENCE_ENABLE,
+	&app_write_REG_DELTA_KEYFRAME_INTERVAL,
+	&app_write_REG_LOAD_CELLS_DELTA,
+	&app_write_REG_DEADBAND,
+	&app_write_REG_DEADBAND_HEARTBEAT_MS,
+	&app_write_REG_FILTER_MODE,
+	&app_write_REG_FILTER_LENGTH,
+	&app_write_REG_FILTER_CHANNELS,
+	&app_write_REG_FILTER_TARGETS,
+	&app_write_REG_VIRTUAL_WEIGHTS,
+	&app_write_REG_VIRTUAL_SHIFT,
+	&app_write_REG_LOAD_CELLS_VIRTUAL,
+	&app_write_REG_DO_TH_COMPARATOR,
+	&app_write_REG_DO_TH_LOW_VALUE,
+	&app_write_REG_DO_TH_SLOPE_SAMPLES,
+	&app_write_REG_DO_LOGIC,
+	&app_write_REG_DO_LOGIC_INPUTS,
+	&app_write_REG_DO_PULSE_WIDTH_MS,
+	&app_write_REG_DO_PULSE_PERIOD_MS,
+	&app_write_REG_DO_PULSE_COUNT,
+	&app_write_REG_DO_SCHEDULE,
+	&app_write_REG_DO_SCHEDULE_LENGTH,
+	&app_write_REG_DO_SCHEDULE_START_TIME,
+	&app_write_REG_DO_SCHEDULE_START,
+	&app_write_REG_DI0_EDGE
 };
 
 
@@ -146,6 +229,14 @@ bool app_write_REG_START(void *a)
    
    if (reg & ~B_START)
       return false;
+   
+   /* Start with an empty averaging window and an empty batch */
+   if (reg && !app_regs.REG_START)
+   {
+      reset_decimation();
+      reset_filter();
+      batch_counter = 0;
+   }
       
    app_regs.REG_START = reg;
 	return true;
@@ -156,6 +247,7 @@ bool app_write_REG_START(void *a)
 /* REG_LOAD_CELLS                                                       */
 /************************************************************************/
 // This register is an array with 8 positions
+// Only the channels of the ports enabled on REG_PORTS_ENABLE are sent
 void app_read_REG_LOAD_CELLS(void) {}
 bool app_write_REG_LOAD_CELLS(void *a) { return false; }
 
@@ -392,11 +484,15 @@ bool app_write_REG_RESERVED3(void *a)
 void app_read_REG_OFFSET_CH0(void) {}
 bool app_write_REG_OFFSET_CH0(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
 	app_regs.REG_OFFSET_CH0 = *((int16_t*)a) * -1;
-   update_offsets(0);
+   offsets_pending[0] = 1;
 	return true;
 }
 
@@ -407,11 +503,15 @@ bool app_write_REG_OFFSET_CH0(void *a)
 void app_read_REG_OFFSET_CH1(void) {}
 bool app_write_REG_OFFSET_CH1(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH1 = *((int16_t*)a) * -1;
-   update_offsets(1);
+   offsets_pending[1] = 1;
    return true;
 }
 
@@ -422,11 +522,15 @@ bool app_write_REG_OFFSET_CH1(void *a)
 void app_read_REG_OFFSET_CH2(void) {}
 bool app_write_REG_OFFSET_CH2(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH2 = *((int16_t*)a) * -1;
-   update_offsets(2);
+   offsets_pending[2] = 1;
    return true;
 }
 
@@ -437,11 +541,15 @@ bool app_write_REG_OFFSET_CH2(void *a)
 void app_read_REG_OFFSET_CH3(void) {}
 bool app_write_REG_OFFSET_CH3(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH3 = *((int16_t*)a) * -1;
-   update_offsets(3);
+   offsets_pending[3] = 1;
    return true;
 }
 
@@ -452,11 +560,15 @@ bool app_write_REG_OFFSET_CH3(void *a)
 void app_read_REG_OFFSET_CH4(void) {}
 bool app_write_REG_OFFSET_CH4(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH4 = *((int16_t*)a) * -1;
-   update_offsets(4);
+   offsets_pending[4] = 1;
    return true;
 }
 
@@ -467,11 +579,15 @@ bool app_write_REG_OFFSET_CH4(void *a)
 void app_read_REG_OFFSET_CH5(void) {}
 bool app_write_REG_OFFSET_CH5(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH5 = *((int16_t*)a) * -1;
-   update_offsets(5);
+   offsets_pending[5] = 1;
    return true;
 }
 
@@ -482,11 +598,15 @@ bool app_write_REG_OFFSET_CH5(void *a)
 void app_read_REG_OFFSET_CH6(void) {}
 bool app_write_REG_OFFSET_CH6(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH6 = *((int16_t*)a) * -1;
-   update_offsets(6);
+   offsets_pending[6] = 1;
    return true;
 }
 
@@ -497,11 +617,15 @@ bool app_write_REG_OFFSET_CH6(void *a)
 void app_read_REG_OFFSET_CH7(void) {}
 bool app_write_REG_OFFSET_CH7(void *a)
 {
+   /* The offsets are owned by the auto-zero while it runs */
+   if (app_regs.REG_AUTO_ZERO)
+      return false;
+   
    if (*((int16_t*)a) < -255 || *((int16_t*)a) > 255)
       return false;
 
    app_regs.REG_OFFSET_CH7 = *((int16_t*)a) * -1;
-   update_offsets(7);
+   offsets_pending[7] = 1;
    return true;
 }
 
@@ -534,7 +658,7 @@ bool app_write_REG_DOS_TH_INV(void *a)
 void app_read_REG_DO0_CH(void) {}
 bool app_write_REG_DO0_CH(void *a)
 {
-	if (*((uint8_t*)a) > GM_SOFTWARE)
+	if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
 	app_regs.REG_DO0_CH = *((uint8_t*)a);
@@ -548,7 +672,7 @@ bool app_write_REG_DO0_CH(void *a)
 void app_read_REG_DO1_CH(void) {}
 bool app_write_REG_DO1_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO1_CH = *((uint8_t*)a);
@@ -562,7 +686,7 @@ bool app_write_REG_DO1_CH(void *a)
 void app_read_REG_DO2_CH(void) {}
 bool app_write_REG_DO2_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO2_CH = *((uint8_t*)a);
@@ -576,7 +700,7 @@ bool app_write_REG_DO2_CH(void *a)
 void app_read_REG_DO3_CH(void) {}
 bool app_write_REG_DO3_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO3_CH = *((uint8_t*)a);
@@ -590,7 +714,7 @@ bool app_write_REG_DO3_CH(void *a)
 void app_read_REG_DO4_CH(void) {}
 bool app_write_REG_DO4_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO4_CH = *((uint8_t*)a);
@@ -604,7 +728,7 @@ bool app_write_REG_DO4_CH(void *a)
 void app_read_REG_DO5_CH(void) {}
 bool app_write_REG_DO5_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO5_CH = *((uint8_t*)a);
@@ -618,7 +742,7 @@ bool app_write_REG_DO5_CH(void *a)
 void app_read_REG_DO6_CH(void) {}
 bool app_write_REG_DO6_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO6_CH = *((uint8_t*)a);
@@ -632,7 +756,7 @@ bool app_write_REG_DO6_CH(void *a)
 void app_read_REG_DO7_CH(void) {}
 bool app_write_REG_DO7_CH(void *a)
 {
-   if (*((uint8_t*)a) > GM_SOFTWARE)
+   if (*((uint8_t*)a) > GM_VIRTUAL3)
       return false;
 
    app_regs.REG_DO7_CH = *((uint8_t*)a);
@@ -753,6 +877,7 @@ bool app_write_REG_DO0_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO0_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -766,6 +891,7 @@ bool app_write_REG_DO1_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO1_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -779,6 +905,7 @@ bool app_write_REG_DO2_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO2_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -792,6 +919,7 @@ bool app_write_REG_DO3_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO3_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -805,6 +933,7 @@ bool app_write_REG_DO4_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO4_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -818,6 +947,7 @@ bool app_write_REG_DO5_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO5_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -831,6 +961,7 @@ bool app_write_REG_DO6_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO6_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -844,6 +975,7 @@ bool app_write_REG_DO7_TH_UP_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO7_TH_UP_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -857,6 +989,7 @@ bool app_write_REG_DO0_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO0_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -870,6 +1003,7 @@ bool app_write_REG_DO1_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO1_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -883,6 +1017,7 @@ bool app_write_REG_DO2_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO2_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -896,6 +1031,7 @@ bool app_write_REG_DO3_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO3_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -909,6 +1045,7 @@ bool app_write_REG_DO4_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO4_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -922,6 +1059,7 @@ bool app_write_REG_DO5_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO5_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -935,6 +1073,7 @@ bool app_write_REG_DO6_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO6_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -948,6 +1087,7 @@ bool app_write_REG_DO7_TH_DOWN_MS(void *a)
 	uint16_t reg = *((uint16_t*)a);
 
 	app_regs.REG_DO7_TH_DOWN_MS = reg;
+	update_threshold_durations();
 	return true;
 }
 
@@ -961,5 +1101,602 @@ bool app_write_REG_EVNT_ENABLE(void *a)
 	uint8_t reg = *((uint8_t*)a);
 
 	app_regs.REG_EVNT_ENABLE = reg;
+   
+   update_di0_capture();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SAMPLE_RATE                                                      */
+/************************************************************************/
+void app_read_REG_SAMPLE_RATE(void) {}
+bool app_write_REG_SAMPLE_RATE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_SAMPLE_RATE_2000HZ)
+      return false;
+
+	app_regs.REG_SAMPLE_RATE = reg;
+   update_sample_rate();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DECIMATION                                                       */
+/************************************************************************/
+void app_read_REG_DECIMATION(void) {}
+bool app_write_REG_DECIMATION(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_DECIMATION_AVG16)
+      return false;
+
+	app_regs.REG_DECIMATION = reg;
+   reset_decimation();
+   update_threshold_durations();
+   update_deadband_heartbeat();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOAD_CELLS_BATCH                                                 */
+/************************************************************************/
+// This register is an array with 8*BATCH_SIZE_MAX positions
+// Only the first 8*REG_BATCH_SIZE positions are sent on each event
+void app_read_REG_LOAD_CELLS_BATCH(void) {}
+bool app_write_REG_LOAD_CELLS_BATCH(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_BATCH_SIZE                                                       */
+/************************************************************************/
+void app_read_REG_BATCH_SIZE(void) {}
+bool app_write_REG_BATCH_SIZE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg < 1 || reg > BATCH_SIZE_MAX)
+      return false;
+
+	app_regs.REG_BATCH_SIZE = reg;
+   batch_counter = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PORTS_ENABLE                                                     */
+/************************************************************************/
+void app_read_REG_PORTS_ENABLE(void) {}
+bool app_write_REG_PORTS_ENABLE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~(B_PORT0 | B_PORT1))
+      return false;
+
+	app_regs.REG_PORTS_ENABLE = reg;
+   update_load_cells_payload();
+   reset_decimation();
+   reset_filter();
+   batch_counter = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_THRESHOLDS_MODE                                                  */
+/************************************************************************/
+void app_read_REG_THRESHOLDS_MODE(void) {}
+bool app_write_REG_THRESHOLDS_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~MSK_THRESHOLDS_MODE)
+      return false;
+
+	app_regs.REG_THRESHOLDS_MODE = reg;
+   update_threshold_durations();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_THRESHOLDS_LATENCY                                               */
+/************************************************************************/
+void app_read_REG_THRESHOLDS_LATENCY(void) {}
+bool app_write_REG_THRESHOLDS_LATENCY(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_AUTO_ZERO                                                        */
+/************************************************************************/
+// Reads the channels that are still being zeroed
+void app_read_REG_AUTO_ZERO(void) {}
+bool app_write_REG_AUTO_ZERO(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   /* Writing 0 aborts and keeps the offsets found so far */
+   if (reg == 0)
+   {
+      app_regs.REG_AUTO_ZERO = 0;
+      return true;
+   }
+   
+   start_auto_zero(reg);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PERF_COUNTERS                                                    */
+/************************************************************************/
+void app_read_REG_PERF_COUNTERS(void) {}
+bool app_write_REG_PERF_COUNTERS(void *a)
+{
+   /* The values written are ignored, any write clears all the counters */
+   for (uint8_t i = 0; i < PERF_N_COUNTERS; i++)
+   {
+      app_regs.REG_PERF_COUNTERS[i] = 0;
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_ENABLE                                                  */
+/************************************************************************/
+void app_read_REG_SEQUENCE_ENABLE(void) {}
+bool app_write_REG_SEQUENCE_ENABLE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~B_SEQUENCE_ENABLE)
+      return false;
+
+	app_regs.REG_SEQUENCE_ENABLE = reg;
+   update_load_cells_payload();
+   batch_counter = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DELTA_KEYFRAME_INTERVAL                                          */
+/************************************************************************/
+void app_read_REG_DELTA_KEYFRAME_INTERVAL(void) {}
+bool app_write_REG_DELTA_KEYFRAME_INTERVAL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_DELTA_KEYFRAME_INTERVAL = reg;
+   reset_delta_reference();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOAD_CELLS_DELTA                                                 */
+/************************************************************************/
+void app_read_REG_LOAD_CELLS_DELTA(void) {}
+bool app_write_REG_LOAD_CELLS_DELTA(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_DEADBAND                                                         */
+/************************************************************************/
+void app_read_REG_DEADBAND(void) {}
+bool app_write_REG_DEADBAND(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_DEADBAND = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DEADBAND_HEARTBEAT_MS                                            */
+/************************************************************************/
+void app_read_REG_DEADBAND_HEARTBEAT_MS(void) {}
+bool app_write_REG_DEADBAND_HEARTBEAT_MS(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_DEADBAND_HEARTBEAT_MS = reg;
+   update_deadband_heartbeat();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FILTER_MODE                                                      */
+/************************************************************************/
+void app_read_REG_FILTER_MODE(void) {}
+bool app_write_REG_FILTER_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_FILTER_MOVING_AVERAGE)
+      return false;
+   
+   /* The moving average keeps fewer samples than the IIR can span */
+   if (reg == GM_FILTER_MOVING_AVERAGE && app_regs.REG_FILTER_LENGTH > FILTER_MA_LENGTH_MAX)
+      return false;
+
+	app_regs.REG_FILTER_MODE = reg;
+   reset_filter();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FILTER_LENGTH                                                    */
+/************************************************************************/
+void app_read_REG_FILTER_LENGTH(void) {}
+bool app_write_REG_FILTER_LENGTH(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > FILTER_LENGTH_MAX)
+      return false;
+   
+   if (app_regs.REG_FILTER_MODE == GM_FILTER_MOVING_AVERAGE && reg > FILTER_MA_LENGTH_MAX)
+      return false;
+
+	app_regs.REG_FILTER_LENGTH = reg;
+   reset_filter();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FILTER_CHANNELS                                                  */
+/************************************************************************/
+void app_read_REG_FILTER_CHANNELS(void) {}
+bool app_write_REG_FILTER_CHANNELS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_FILTER_CHANNELS = reg;
+   reset_filter();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FILTER_TARGETS                                                   */
+/************************************************************************/
+void app_read_REG_FILTER_TARGETS(void) {}
+bool app_write_REG_FILTER_TARGETS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~(B_FILTER_THRESHOLDS | B_FILTER_LOAD_CELLS))
+      return false;
+
+	app_regs.REG_FILTER_TARGETS = reg;
+   
+   /* Don't mix filtered and unfiltered samples in the same average */
+   reset_decimation();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VIRTUAL_WEIGHTS                                                  */
+/************************************************************************/
+// Weights of virtual channel v are at positions [8*v..8*v+7]
+void app_read_REG_VIRTUAL_WEIGHTS(void) {}
+bool app_write_REG_VIRTUAL_WEIGHTS(void *a)
+{
+	int8_t * reg = ((int8_t*)a);
+   
+   for (uint8_t i = 0; i < 8*VIRTUAL_N_CHANNELS; i++)
+   {
+      app_regs.REG_VIRTUAL_WEIGHTS[i] = reg[i];
+   }
+   
+   update_virtual_channel_inputs();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VIRTUAL_SHIFT                                                    */
+/************************************************************************/
+void app_read_REG_VIRTUAL_SHIFT(void) {}
+bool app_write_REG_VIRTUAL_SHIFT(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < VIRTUAL_N_CHANNELS; i++)
+   {
+      if (reg[i] > VIRTUAL_SHIFT_MAX)
+         return false;
+   }
+   
+   for (uint8_t i = 0; i < VIRTUAL_N_CHANNELS; i++)
+   {
+      app_regs.REG_VIRTUAL_SHIFT[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOAD_CELLS_VIRTUAL                                               */
+/************************************************************************/
+void app_read_REG_LOAD_CELLS_VIRTUAL(void) {}
+bool app_write_REG_LOAD_CELLS_VIRTUAL(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_DO_TH_COMPARATOR                                                 */
+/************************************************************************/
+void app_read_REG_DO_TH_COMPARATOR(void) {}
+bool app_write_REG_DO_TH_COMPARATOR(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (reg[i] > GM_COMPARATOR_SLOPE)
+         return false;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_TH_COMPARATOR[i] = reg[i];
+   }
+   
+   reset_slopes();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_TH_LOW_VALUE                                                  */
+/************************************************************************/
+void app_read_REG_DO_TH_LOW_VALUE(void) {}
+bool app_write_REG_DO_TH_LOW_VALUE(void *a)
+{
+	int16_t * reg = ((int16_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_TH_LOW_VALUE[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_TH_SLOPE_SAMPLES                                              */
+/************************************************************************/
+void app_read_REG_DO_TH_SLOPE_SAMPLES(void) {}
+bool app_write_REG_DO_TH_SLOPE_SAMPLES(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (reg[i] < 1 || reg[i] > SLOPE_SAMPLES_MAX)
+         return false;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_TH_SLOPE_SAMPLES[i] = reg[i];
+   }
+   
+   reset_slopes();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_LOGIC                                                         */
+/************************************************************************/
+void app_read_REG_DO_LOGIC(void) {}
+bool app_write_REG_DO_LOGIC(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (reg[i] > GM_LOGIC_DISABLED)
+         return false;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_LOGIC[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_LOGIC_INPUTS                                                  */
+/************************************************************************/
+void app_read_REG_DO_LOGIC_INPUTS(void) {}
+bool app_write_REG_DO_LOGIC_INPUTS(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_LOGIC_INPUTS[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_PULSE_WIDTH_MS                                                */
+/************************************************************************/
+void app_read_REG_DO_PULSE_WIDTH_MS(void) {}
+bool app_write_REG_DO_PULSE_WIDTH_MS(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_PULSE_WIDTH_MS[i] = reg[i];
+   }
+   
+   update_pulsed_outputs();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_PULSE_PERIOD_MS                                               */
+/************************************************************************/
+// Periods not longer than the width leave the output low for 1 ms
+void app_read_REG_DO_PULSE_PERIOD_MS(void) {}
+bool app_write_REG_DO_PULSE_PERIOD_MS(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_PULSE_PERIOD_MS[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_PULSE_COUNT                                                   */
+/************************************************************************/
+void app_read_REG_DO_PULSE_COUNT(void) {}
+bool app_write_REG_DO_PULSE_COUNT(void *a)
+{
+	uint8_t * reg = ((uint8_t*)a);
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      if (reg[i] < 1)
+         return false;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_DO_PULSE_COUNT[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_SCHEDULE                                                      */
+/************************************************************************/
+// Entries are written as pairs of delay (us) from the previous entry and action << 16 | outputs
+void app_read_REG_DO_SCHEDULE(void) {}
+bool app_write_REG_DO_SCHEDULE(void *a)
+{
+	uint32_t * reg = ((uint32_t*)a);
+   
+   for (uint8_t i = 0; i < SCHEDULE_MAX_ENTRIES; i++)
+   {
+      if (reg[i*2] > SCHEDULE_MAX_DELAY_US)
+         return false;
+      
+      if ((reg[i*2 + 1] >> 16) > SCHEDULE_ACTION_TOGGLE || (reg[i*2 + 1] & 0xFFFF & ~MSK_SCHEDULE_OUTPUTS))
+         return false;
+   }
+   
+   /* Not while it is being played */
+   stop_do_schedule();
+   
+   for (uint8_t i = 0; i < 2*SCHEDULE_MAX_ENTRIES; i++)
+   {
+      app_regs.REG_DO_SCHEDULE[i] = reg[i];
+   }
+   
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_SCHEDULE_LENGTH                                               */
+/************************************************************************/
+void app_read_REG_DO_SCHEDULE_LENGTH(void) {}
+bool app_write_REG_DO_SCHEDULE_LENGTH(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > SCHEDULE_MAX_ENTRIES)
+      return false;
+   
+   stop_do_schedule();
+   
+	app_regs.REG_DO_SCHEDULE_LENGTH = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_SCHEDULE_START_TIME                                           */
+/************************************************************************/
+void app_read_REG_DO_SCHEDULE_START_TIME(void) {}
+bool app_write_REG_DO_SCHEDULE_START_TIME(void *a)
+{
+	uint32_t * reg = ((uint32_t*)a);
+   
+   if (reg[1] > 999999)
+      return false;
+   
+   app_regs.REG_DO_SCHEDULE_START_TIME[0] = reg[0];
+   app_regs.REG_DO_SCHEDULE_START_TIME[1] = reg[1];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DO_SCHEDULE_START                                                */
+/************************************************************************/
+void app_read_REG_DO_SCHEDULE_START(void) {}
+bool app_write_REG_DO_SCHEDULE_START(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_SCHEDULE_DI0_FALL)
+      return false;
+   
+   /* A new start drops the schedule being played, the outputs stay as they are */
+   stop_do_schedule();
+   
+   if (reg == GM_SCHEDULE_NOW)
+   {
+      start_do_schedule(0);
+   }
+   else
+   {
+      app_regs.REG_DO_SCHEDULE_START = reg;
+   }
+   
 	return true;
-}
\ No newline at end of file
+}
+
+
+/************************************************************************/
+/* REG_DI0_EDGE                                                         */
+/************************************************************************/
+void app_read_REG_DI0_EDGE(void) {}
+bool app_write_REG_DI0_EDGE(void *a) { return false; }
\ No newline at end of file
@@ -79,6 +79,40 @@ void app_read_REG_DO5_TH_DOWN_MS(void);
 void app_read_REG_DO6_TH_DOWN_MS(void);
 void app_read_REG_DO7_TH_DOWN_MS(void);
 void app_read_REG_EVNT_ENABLE(void);
+void app_read_REG_SAMPLE_RATE(void);
+void app_read_REG_DECIMATION(void);
+void app_read_REG_LOAD_CELLS_BATCH(void);
+void app_read_REG_BATCH_SIZE(void);
+void app_read_REG_PORTS_ENABLE(void);
+void app_read_REG_THRESHOLDS_MODE(void);
+void app_read_REG_THRESHOLDS_LATENCY(void);
+void app_read_REG_AUTO_ZERO(void);
+void app_read_REG_PERF_COUNTERS(void);
+void app_read_REG_SEQUENCE_ENABLE(void);
+void app_read_REG_DELTA_KEYFRAME_INTERVAL(void);
+void app_read_REG_LOAD_CELLS_DELTA(void);
+void app_read_REG_DEADBAND(void);
+void app_read_REG_DEADBAND_HEARTBEAT_MS(void);
+void app_read_REG_FILTER_MODE(void);
+void app_read_REG_FILTER_LENGTH(void);
+void app_read_REG_FILTER_CHANNELS(void);
+void app_read_REG_FILTER_TARGETS(void);
+void app_read_REG_VIRTUAL_WEIGHTS(void);
+void app_read_REG_VIRTUAL_SHIFT(void);
+void app_read_REG_LOAD_CELLS_VIRTUAL(void);
+void app_read_REG_DO_TH_COMPARATOR(void);
+void app_read_REG_DO_TH_LOW_VALUE(void);
+void app_read_REG_DO_TH_SLOPE_SAMPLES(void);
+void app_read_REG_DO_LOGIC(void);
+void app_read_REG_DO_LOGIC_INPUTS(void);
+void app_read_REG_DO_PULSE_WIDTH_MS(void);
+void app_read_REG_DO_PULSE_PERIOD_MS(void);
+void app_read_REG_DO_PULSE_COUNT(void);
+void app_read_REG_DO_SCHEDULE(void);
+void app_read_REG_DO_SCHEDULE_LENGTH(void);
+void app_read_REG_DO_SCHEDULE_START_TIME(void);
+void app_read_REG_DO_SCHEDULE_START(void);
+void app_read_REG_DI0_EDGE(void);
 
 bool app_write_REG_START(void *a);
 bool app_write_REG_LOAD_CELLS(void *a);
@@ -139,6 +173,40 @@ bool app_write_REG_DO5_TH_DOWN_MS(void *a);
 bool app_write_REG_DO6_TH_DOWN_MS(void *a);
 bool app_write_REG_DO7_TH_DOWN_MS(void *a);
 bool app_write_REG_EVNT_ENABLE(void *a);
+bool app_write_REG_SAMPLE_RATE(void *a);
+bool app_write_REG_DECIMATION(void *a);
+bool app_write_REG_LOAD_CELLS_BATCH(void *a);
+bool app_write_REG_BATCH_SIZE(void *a);
+bool app_write_REG_PORTS_ENABLE(void *a);
+bool app_write_REG_THRESHOLDS_MODE(void *a);
+bool app_write_REG_THRESHOLDS_LATENCY(void *a);
+bool app_write_REG_AUTO_ZERO(void *a);
+bool app_write_REG_PERF_COUNTERS(void *a);
+bool app_write_REG_SEQUENCE_ENABLE(void *a);
+bool app_write_REG_DELTA_KEYFRAME_INTERVAL(void *a);
+bool app_write_REG_LOAD_CELLS_DELTA(void *a);
+bool app_write_REG_DEADBAND(void *a);
+bool app_write_REG_DEADBAND_HEARTBEAT_MS(void *a);
+bool app_write_REG_FILTER_MODE(void *a);
+bool app_write_REG_FILTER_LENGTH(void *a);
+bool app_write_REG_FILTER_CHANNELS(void *a);
+bool app_write_REG_FILTER_TARGETS(void *a);
+bool app_write_REG_VIRTUAL_WEIGHTS(void *a);
+bool app_write_REG_VIRTUAL_SHIFT(void *a);
+bool app_write_REG_LOAD_CELLS_VIRTUAL(void *a);
+bool app_write_REG_DO_TH_COMPARATOR(void *a);
+bool app_write_REG_DO_TH_LOW_VALUE(void *a);
+bool app_write_REG_DO_TH_SLOPE_SAMPLES(void *a);
+bool app_write_REG_DO_LOGIC(void *a);
+bool app_write_REG_DO_LOGIC_INPUTS(void *a);
+bool app_write_REG_DO_PULSE_WIDTH_MS(void *a);
+bool app_write_REG_DO_PULSE_PERIOD_MS(void *a);
+bool app_write_REG_DO_PULSE_COUNT(void *a);
+bool app_write_REG_DO_SCHEDULE(void *a);
+bool app_write_REG_DO_SCHEDULE_LENGTH(void *a);
+bool app_write_REG_DO_SCHEDULE_START_TIME(void *a);
+bool app_write_REG_DO_SCHEDULE_START(void *a);
+bool app_write_REG_DI0_EDGE(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -121,7 +121,41 @@ uint8_t app_regs_type[] = {
 	TYPE_U16,
 	TYPE_U16,
 	TYPE_U16,
-	TYPE_U8
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_I8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_I8,
+	TYPE_U8,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_I16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U16
 };
 
 uint16_t app_regs_n_elements[] = {
@@ -183,7 +217,41 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
-	1
+	1,
+	1,
+	1,
+	8*BATCH_SIZE_MAX,
+	1,
+	1,
+	1,
+	1,
+	1,
+	PERF_N_COUNTERS,
+	1,
+	1,
+	8,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	8*VIRTUAL_N_CHANNELS,
+	VIRTUAL_N_CHANNELS,
+	VIRTUAL_N_CHANNELS,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	8,
+	2*SCHEDULE_MAX_ENTRIES,
+	1,
+	2,
+	1,
+	2
 };
 
 uint8_t *app_regs_pointer[] = {
@@ -245,5 +313,39 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_DO5_TH_DOWN_MS),
 	(uint8_t*)(&app_regs.REG_DO6_TH_DOWN_MS),
 	(uint8_t*)(&app_regs.REG_DO7_TH_DOWN_MS),
-	(uint8_t*)(&app_regs.REG_EVNT_ENABLE)
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE),
+	(uint8_t*)(&app_regs.REG_SAMPLE_RATE),
+	(uint8_t*)(&app_regs.REG_DECIMATION),
+	(uint8_t*)(app_regs.REG_LOAD_CELLS_BATCH),
+	(uint8_t*)(&app_regs.REG_BATCH_SIZE),
+	(uint8_t*)(&app_regs.REG_PORTS_ENABLE),
+	(uint8_t*)(&app_regs.REG_THRESHOLDS_MODE),
+	(uint8_t*)(&app_regs.REG_THRESHOLDS_LATENCY),
+	(uint8_t*)(&app_regs.REG_AUTO_ZERO),
+	(uint8_t*)(app_regs.REG_PERF_COUNTERS),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_ENABLE),
+	(uint8_t*)(&app_regs.REG_DELTA_KEYFRAME_INTERVAL),
+	(uint8_t*)(app_regs.REG_LOAD_CELLS_DELTA),
+	(uint8_t*)(&app_regs.REG_DEADBAND),
+	(uint8_t*)(&app_regs.REG_DEADBAND_HEARTBEAT_MS),
+	(uint8_t*)(&app_regs.REG_FILTER_MODE),
+	(uint8_t*)(&app_regs.REG_FILTER_LENGTH),
+	(uint8_t*)(&app_regs.REG_FILTER_CHANNELS),
+	(uint8_t*)(&app_regs.REG_FILTER_TARGETS),
+	(uint8_t*)(app_regs.REG_VIRTUAL_WEIGHTS),
+	(uint8_t*)(app_regs.REG_VIRTUAL_SHIFT),
+	(uint8_t*)(app_regs.REG_LOAD_CELLS_VIRTUAL),
+	(uint8_t*)(app_regs.REG_DO_TH_COMPARATOR),
+	(uint8_t*)(app_regs.REG_DO_TH_LOW_VALUE),
+	(uint8_t*)(app_regs.REG_DO_TH_SLOPE_SAMPLES),
+	(uint8_t*)(app_regs.REG_DO_LOGIC),
+	(uint8_t*)(app_regs.REG_DO_LOGIC_INPUTS),
+	(uint8_t*)(app_regs.REG_DO_PULSE_WIDTH_MS),
+	(uint8_t*)(app_regs.REG_DO_PULSE_PERIOD_MS),
+	(uint8_t*)(app_regs.REG_DO_PULSE_COUNT),
+	(uint8_t*)(app_regs.REG_DO_SCHEDULE),
+	(uint8_t*)(&app_regs.REG_DO_SCHEDULE_LENGTH),
+	(uint8_t*)(app_regs.REG_DO_SCHEDULE_START_TIME),
+	(uint8_t*)(&app_regs.REG_DO_SCHEDULE_START),
+	(uint8_t*)(app_regs.REG_DI0_EDGE)
 };
\ No newline at end of file
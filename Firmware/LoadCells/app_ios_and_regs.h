@@ -151,10 +151,28 @@ void init_ios(void);
 #define tgl_SCK1 toggle_io(PORTD, 7)
 #define read_SCK1 read_io(PORTD, 7)
 
+/* TCC0 and TCD0 generate CONVST0 and CONVST1 on their compare A outputs */
+#define SAMPLE_TIMER_TICKS_PER_US 4
+#define CONVST_PULSE_TICKS        (2 * SAMPLE_TIMER_TICKS_PER_US)
+#define READOUT_DELAY_TICKS       (350 * SAMPLE_TIMER_TICKS_PER_US)
+#define SAMPLE_TIMER_TICKS_TO_CYCLES(ticks) ((uint32_t)(ticks) << 3)   // 32 MHz CPU, timer at DIV8
+
 
 /************************************************************************/
 /* Registers' structure                                                 */
 /************************************************************************/
+/* A Harp payload can't go above 255 bytes, so 15 frames of 16 bytes is the maximum */
+#define BATCH_SIZE_MAX 15
+
+#define PERF_N_COUNTERS 8
+
+#define VIRTUAL_N_CHANNELS 4
+
+/* Each entry of the DO schedule takes two words, 30 entries fill a Harp payload */
+#define SCHEDULE_MAX_ENTRIES 30
+
+/* The bank is saved and sent byte by byte, so it has no padding on any target */
+#pragma pack(push, 1)
 typedef struct
 {
 	uint8_t REG_START;
@@ -216,7 +234,42 @@ typedef struct
 	uint16_t REG_DO6_TH_DOWN_MS;
 	uint16_t REG_DO7_TH_DOWN_MS;
 	uint8_t REG_EVNT_ENABLE;
+	uint8_t REG_SAMPLE_RATE;
+	uint8_t REG_DECIMATION;
+	int16_t REG_LOAD_CELLS_BATCH[8*BATCH_SIZE_MAX];
+	uint8_t REG_BATCH_SIZE;
+	uint8_t REG_PORTS_ENABLE;
+	uint8_t REG_THRESHOLDS_MODE;
+	uint16_t REG_THRESHOLDS_LATENCY;
+	uint8_t REG_AUTO_ZERO;
+	uint32_t REG_PERF_COUNTERS[PERF_N_COUNTERS];
+	uint8_t REG_SEQUENCE_ENABLE;
+	uint8_t REG_DELTA_KEYFRAME_INTERVAL;
+	int8_t REG_LOAD_CELLS_DELTA[9];
+	uint16_t REG_DEADBAND;
+	uint16_t REG_DEADBAND_HEARTBEAT_MS;
+	uint8_t REG_FILTER_MODE;
+	uint8_t REG_FILTER_LENGTH;
+	uint8_t REG_FILTER_CHANNELS;
+	uint8_t REG_FILTER_TARGETS;
+	int8_t REG_VIRTUAL_WEIGHTS[8*VIRTUAL_N_CHANNELS];
+	uint8_t REG_VIRTUAL_SHIFT[VIRTUAL_N_CHANNELS];
+	int16_t REG_LOAD_CELLS_VIRTUAL[VIRTUAL_N_CHANNELS];
+	uint8_t REG_DO_TH_COMPARATOR[8];
+	int16_t REG_DO_TH_LOW_VALUE[8];
+	uint8_t REG_DO_TH_SLOPE_SAMPLES[8];
+	uint8_t REG_DO_LOGIC[8];
+	uint8_t REG_DO_LOGIC_INPUTS[8];
+	uint16_t REG_DO_PULSE_WIDTH_MS[8];
+	uint16_t REG_DO_PULSE_PERIOD_MS[8];
+	uint8_t REG_DO_PULSE_COUNT[8];
+	uint32_t REG_DO_SCHEDULE[2*SCHEDULE_MAX_ENTRIES];
+	uint8_t REG_DO_SCHEDULE_LENGTH;
+	uint32_t REG_DO_SCHEDULE_START_TIME[2];
+	uint8_t REG_DO_SCHEDULE_START;
+	uint16_t REG_DI0_EDGE[2];
 } AppRegs;
+#pragma pack(pop)
 
 /************************************************************************/
 /* Registers' address                                                   */
@@ -281,6 +334,40 @@ typedef struct
 #define ADD_REG_DO6_TH_DOWN_MS              88 // U16    
 #define ADD_REG_DO7_TH_DOWN_MS              89 // U16    
 #define ADD_REG_EVNT_ENABLE                 90 // U8     Enable the Events
+#define ADD_REG_SAMPLE_RATE                 91 // U8     Sample rate of the load cells
+#define ADD_REG_DECIMATION                  92 // U8     Number of samples averaged into each LOAD_CELLS event
+#define ADD_REG_LOAD_CELLS_BATCH            93 // I16    Consecutive frames of LOAD_CELLS sent in a single event
+#define ADD_REG_BATCH_SIZE                  94 // U8     Number of frames in each LOAD_CELLS_BATCH event [1:15]
+#define ADD_REG_PORTS_ENABLE                95 // U8     Ports that are converted, read and sent
+#define ADD_REG_THRESHOLDS_MODE             96 // U8     Selects when the thresholds are evaluated
+#define ADD_REG_THRESHOLDS_LATENCY          97 // U16    Time (us) from the conversion start to the last output changed by the thresholds
+#define ADD_REG_AUTO_ZERO                   98 // U8     Starts the auto-zero of the selected channels
+#define ADD_REG_PERF_COUNTERS               99 // U32    Performance counters, writing any value resets them
+#define ADD_REG_SEQUENCE_ENABLE             100 // U8     Appends the sample sequence number to the LOAD_CELLS frames
+#define ADD_REG_DELTA_KEYFRAME_INTERVAL     101 // U8     Sends LOAD_CELLS as 8-bit deltas with a full frame every N frames [0:off]
+#define ADD_REG_LOAD_CELLS_DELTA            102 // I8     Difference of each channel to the previous LOAD_CELLS frame
+#define ADD_REG_DEADBAND                    103 // U16    Change of any channel needed to send a LOAD_CELLS event [0:off]
+#define ADD_REG_DEADBAND_HEARTBEAT_MS       104 // U16    Longest time without a LOAD_CELLS event while in the deadband [0:none]
+#define ADD_REG_FILTER_MODE                 105 // U8     Filter applied to each sample after its readout
+#define ADD_REG_FILTER_LENGTH               106 // U8     Filter spans 2^N samples [0:8], [0:4] for the moving average
+#define ADD_REG_FILTER_CHANNELS             107 // U8     Channels that are filtered
+#define ADD_REG_FILTER_TARGETS              108 // U8     Selects what uses the filtered channels
+#define ADD_REG_VIRTUAL_WEIGHTS             109 // I8     Weight of each channel, 8 per virtual channel
+#define ADD_REG_VIRTUAL_SHIFT               110 // U8     Right shift applied to each virtual channel [0:15]
+#define ADD_REG_LOAD_CELLS_VIRTUAL          111 // I16    Weighted sums of the channels of each LOAD_CELLS frame
+#define ADD_REG_DO_TH_COMPARATOR            112 // U8     Comparator of each output's threshold
+#define ADD_REG_DO_TH_LOW_VALUE             113 // I16    Lower threshold of each output, for the hysteresis and window comparators
+#define ADD_REG_DO_TH_SLOPE_SAMPLES         114 // U8     Samples over which the slope comparator measures the change [1:16]
+#define ADD_REG_DO_LOGIC                    115 // U8     Selects what drives each output
+#define ADD_REG_DO_LOGIC_INPUTS             116 // U8     Comparators combined by each output's logic
+#define ADD_REG_DO_PULSE_WIDTH_MS           117 // U16    Width of the pulses fired by each output's threshold [0:output follows the threshold]
+#define ADD_REG_DO_PULSE_PERIOD_MS          118 // U16    Period of the pulses of a train
+#define ADD_REG_DO_PULSE_COUNT              119 // U8     Pulses fired on each threshold crossing [1:255]
+#define ADD_REG_DO_SCHEDULE                 120 // U32    Entries of the DO schedule, each as delay (us) and action << 16 | outputs
+#define ADD_REG_DO_SCHEDULE_LENGTH          121 // U8     Entries of DO_SCHEDULE that are played [0:30]
+#define ADD_REG_DO_SCHEDULE_START_TIME      122 // U32    Harp time (seconds, microseconds) to start the DO schedule at
+#define ADD_REG_DO_SCHEDULE_START           123 // U8     Starts or stops the DO schedule, reads whether it is playing
+#define ADD_REG_DI0_EDGE                    124 // U16    Edges of DI0 captured by TCE0, as level and capture count (0.25 us)
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -290,8 +377,11 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x5A
-#define APP_NBYTES_OF_REG_BANK              110
+#define APP_REGS_ADD_MAX                    0x7C
+#define APP_NBYTES_OF_REG_BANK              795
+
+/* The core saves, restores and dumps APP_NBYTES_OF_REG_BANK bytes of the bank */
+_Static_assert(sizeof(AppRegs) == APP_NBYTES_OF_REG_BANK, "APP_NBYTES_OF_REG_BANK doesn't match AppRegs");
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -325,9 +415,85 @@ typedef struct
 #define GM_CH6                             (6<<0)       // Load Cell channel 6
 #define GM_CH7                             (7<<0)       // Load Cell channel 7
 #define GM_SOFTWARE                        (8<<0)       // Filter not used -- Use pin as a pure digital output
+#define GM_VIRTUAL0                        (9<<0)       // Virtual channel 0
+#define GM_VIRTUAL1                        (10<<0)      // Virtual channel 1
+#define GM_VIRTUAL2                        (11<<0)      // Virtual channel 2
+#define GM_VIRTUAL3                        (12<<0)      // Virtual channel 3
 #define B_EVT_LOAD_CELLS                   (1<<0)       // Event of register LOAD_CELLS
 #define B_EVT_DI0                          (1<<1)       // Event of register DI0
 #define B_EVT_DO0                          (1<<2)       // Event of register DO0
 #define B_EVT_DO_OUT                       (1<<3)       // Event of THRESHOLDS
+#define B_EVT_LOAD_CELLS_BATCH             (1<<4)       // Event of register LOAD_CELLS_BATCH
+#define B_EVT_LOAD_CELLS_VIRTUAL           (1<<5)       // Event of register LOAD_CELLS_VIRTUAL
+#define B_EVT_DO_SCHEDULE                  (1<<6)       // Event of register DO_SCHEDULE_START, when the schedule ends
+#define B_EVT_DI0_EDGE                     (1<<7)       // Event of register DI0_EDGE, also enables the capture
+#define B_PORT0                            (1<<0)       // Load Cell channels 0 to 3
+#define B_PORT1                            (1<<1)       // Load Cell channels 4 to 7
+#define MSK_SAMPLE_RATE                    (7<<0)       // 
+#define GM_SAMPLE_RATE_100HZ               (0<<0)       // 100 samples per second
+#define GM_SAMPLE_RATE_200HZ               (1<<0)       // 200 samples per second
+#define GM_SAMPLE_RATE_250HZ               (2<<0)       // 250 samples per second
+#define GM_SAMPLE_RATE_500HZ               (3<<0)       // 500 samples per second
+#define GM_SAMPLE_RATE_1000HZ              (4<<0)       // 1000 samples per second
+#define GM_SAMPLE_RATE_2000HZ              (5<<0)       // 2000 samples per second
+#define MSK_DECIMATION                     (7<<0)       // 
+#define GM_DECIMATION_NONE                 (0<<0)       // Each sample is reported
+#define GM_DECIMATION_AVG2                 (1<<0)       // Average of 2 samples
+#define GM_DECIMATION_AVG4                 (2<<0)       // Average of 4 samples
+#define GM_DECIMATION_AVG8                 (3<<0)       // Average of 8 samples
+#define GM_DECIMATION_AVG16                (4<<0)       // Average of 16 samples
+#define MSK_THRESHOLDS_MODE                (1<<0)       // 
+#define GM_THRESHOLDS_DECIMATED            (0<<0)       // Evaluated on the reported samples, after the events
+#define GM_THRESHOLDS_LOW_LATENCY          (1<<0)       // Evaluated on every sample, as soon as it is read
+#define B_CH0                               (1<<0)       // Load Cell channel 0
+#define B_CH1                               (1<<1)       // Load Cell channel 1
+#define B_CH2                               (1<<2)       // Load Cell channel 2
+#define B_CH3                               (1<<3)       // Load Cell channel 3
+#define B_CH4                               (1<<4)       // Load Cell channel 4
+#define B_CH5                               (1<<5)       // Load Cell channel 5
+#define B_CH6                               (1<<6)       // Load Cell channel 6
+#define B_CH7                               (1<<7)       // Load Cell channel 7
+#define PERF_SAMPLES_ACQUIRED              0            // Samples read from the ADCs
+#define PERF_SAMPLES_DROPPED               1            // Conversions lost because the previous readout was still on going
+#define PERF_EVENTS_DROPPED                2            // Load cells events not sent because the TX buffer was full
+#define PERF_READOUT_MAX_CYCLES            3            // Longest processing of a sample after its readout
+#define PERF_THRESHOLDS_MAX_CYCLES         4            // Longest process_thresholds()
+#define PERF_TX_BUFFER_MAX                 5            // Most bytes waiting in the TX buffer
+#define PERF_DI0_EDGES_DROPPED             6            // DI0 edges lost because the capture buffer or the queue was full
+#define PERF_SCHEDULE_ENTRIES_MERGED       7            // DO schedule entries played late, with the entry before them
+#define B_SEQUENCE_ENABLE                  (1<<0)       // The last element of each LOAD_CELLS frame is the sequence number
+#define MSK_FILTER_MODE                    (3<<0)       //
+#define GM_FILTER_NONE                     (0<<0)       // The samples are used as read
+#define GM_FILTER_IIR                      (1<<0)       // First order low-pass, y += (x - y) / 2^FILTER_LENGTH
+#define GM_FILTER_MOVING_AVERAGE           (2<<0)       // Average of the last 2^FILTER_LENGTH samples
+#define FILTER_LENGTH_MAX                  8            //
+#define FILTER_MA_LENGTH_MAX               4            // Moving average of 16 samples at most
+#define B_FILTER_THRESHOLDS                (1<<0)       // The thresholds use the filtered channels
+#define B_FILTER_LOAD_CELLS                (1<<1)       // LOAD_CELLS and its batches report the filtered channels
+#define VIRTUAL_SHIFT_MAX                  15           //
+#define MSK_COMPARATOR                     (7<<0)       //
+#define GM_COMPARATOR_LEVEL                (0<<0)       // Active at or above DOx_TH_VALUE (at or below, if inverted)
+#define GM_COMPARATOR_HYSTERESIS           (1<<0)       // Active at or above DOx_TH_VALUE until it goes below DO_TH_LOW_VALUE
+#define GM_COMPARATOR_WINDOW               (2<<0)       // Active from DO_TH_LOW_VALUE to DOx_TH_VALUE
+#define GM_COMPARATOR_OUT_OF_WINDOW        (3<<0)       // Active below DO_TH_LOW_VALUE or above DOx_TH_VALUE
+#define GM_COMPARATOR_SLOPE                (4<<0)       // Active when the input rose DOx_TH_VALUE or more in DO_TH_SLOPE_SAMPLES samples
+#define SLOPE_SAMPLES_MAX                  16           //
+#define MSK_LOGIC                          (7<<0)       //
+#define GM_LOGIC_COMPARATOR                (0<<0)       // The output follows its own comparator
+#define GM_LOGIC_AND                       (1<<0)       // Active when all the comparators in DO_LOGIC_INPUTS are
+#define GM_LOGIC_OR                        (2<<0)       // Active when any of the comparators in DO_LOGIC_INPUTS is
+#define GM_LOGIC_XOR                       (3<<0)       // Active when an odd number of the comparators in DO_LOGIC_INPUTS are
+#define GM_LOGIC_DISABLED                  (4<<0)       // The comparator is evaluated, but the thresholds don't drive the output
+#define MSK_SCHEDULE_START                 (7<<0)       //
+#define GM_SCHEDULE_STOP                   (0<<0)       // Stops the schedule, reads as 0 when it isn't playing
+#define GM_SCHEDULE_NOW                    (1<<0)       // Starts the schedule at once
+#define GM_SCHEDULE_AT_TIME                (2<<0)       // Starts the schedule at DO_SCHEDULE_START_TIME
+#define GM_SCHEDULE_DI0_RISE               (3<<0)       // Starts the schedule on the next rising edge of DI0
+#define GM_SCHEDULE_DI0_FALL               (4<<0)       // Starts the schedule on the next falling edge of DI0
+#define MSK_SCHEDULE_OUTPUTS               0x01FF       // Outputs of an entry, as in DO_OUT
+#define SCHEDULE_ACTION_SET                0            // Action of an entry, as DO_SET
+#define SCHEDULE_ACTION_CLEAR              1            // Action of an entry, as DO_CLEAR
+#define SCHEDULE_ACTION_TOGGLE             2            // Action of an entry, as DO_TOGGLE
+#define SCHEDULE_MAX_DELAY_US              100000000UL  // Longest delay of an entry, 100 s
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
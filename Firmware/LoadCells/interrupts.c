@@ -23,14 +23,43 @@ extern AppRegs app_regs;
 // ISR(TCF0_CCA_vect, ISR_NAKED)
 // 
 // ISR(TCD1_OVF_vect, ISR_NAKED)
-// 
-// ISR(TCD1_CCA_vect, ISR_NAKED)
+
+/************************************************************************/ 
+/* DO schedule                                                          */
+/************************************************************************/
+void advance_do_schedule(uint16_t from);
+void start_do_schedule(uint32_t delay_us);
+
+/* TCD1 reached the time of the next entry, or of a step towards it */
+ISR(TCD1_CCA_vect, ISR_NAKED)
+{
+   advance_do_schedule(TCD1.CCA);
+   
+   reti();
+}
 
 /************************************************************************/ 
 /* DI0                                                                  */
 /************************************************************************/
+void queue_di0_edge(uint16_t capture);
+
+/* TCE0 captured an edge, reading CCA brings in the next capture if there is one */
+/* The edge is only queued, the 500 us tick sends it */
+ISR(TCE0_CCA_vect, ISR_NAKED)
+{
+   queue_di0_edge(TCE0.CCA);
+   
+   reti();
+}
+
 ISR(PORTB_INT0_vect, ISR_NAKED)
 {
+   /* The DO schedule may be waiting for this edge */
+   if (app_regs.REG_DO_SCHEDULE_START == (read_DI0 ? GM_SCHEDULE_DI0_RISE : GM_SCHEDULE_DI0_FALL))
+   {
+      start_do_schedule(0);
+   }
+   
    if (read_DI0)
    {
       switch (app_regs.REG_DI0_CONF)
@@ -90,64 +119,269 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 /************************************************************************/
 /* ADC is ready to be read                                              */
 /************************************************************************/
-ISR(TCC0_OVF_vect, ISR_NAKED)
+extern uint8_t adc_dma_buffer[];
+extern volatile uint8_t adc_dma_pending;
+void adc_dma_start(uint8_t ports);
+void process_thresholds(int16_t * values);
+void process_auto_zero(int16_t * sample, uint8_t valid_channels);
+void process_filter(int16_t * sample);
+bool send_event_if_room(uint8_t add, bool use_core_timestamp);
+uint16_t sample_timer_elapsed(uint16_t start);
+void perf_keep_max_cycles(uint8_t counter, uint16_t ticks);
+
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+extern uint8_t batch_counter;
+extern uint32_t batch_second;
+extern uint16_t batch_usecond;
+
+extern int32_t decimation_accumulator[];
+extern uint8_t decimation_counter;
+
+extern int16_t filter_output[];
+
+extern uint16_t sample_sequence;
+extern uint16_t load_cells_sequence;
+void update_load_cells_frame(void);
+void send_load_cells_event(void);
+void compute_virtual_channels(int16_t * values, int16_t * virtual_values);
+
+bool port0_has_board;
+bool port1_has_board;
+
+uint8_t sampled_ports = 0;    // Ports whose CONVST was enabled for the current period
+
+/* TCC0 BOTTOM started the conversion 350 us ago */
+ISR(TCC0_CCB_vect, ISR_NAKED)
 {
-   timer_type0_stop(&TCC0);
+   uint8_t ports = sampled_ports;
    
-   bool port0_has_board = read_CS0_1 ? true : false;
-   bool port1_has_board = read_CS1_1 ? true : false;
+   if (ports)
+   {
+      sample_sequence++;
+   }
    
-   /* From (A) to (B) With CPU @ 32 MHz this lines takes 24 us to run */
-   //--------------------------------------------------------------------(A)
+   /* The DMA is still busy with the previous sample, so this conversion is lost */
+   if (ports && adc_dma_pending)
+   {
+      app_regs.REG_PERF_COUNTERS[PERF_SAMPLES_DROPPED]++;
+      ports = 0;
+   }
    
-   clr_CS0_1;     // Clear Port0 ADC !CS
-   clr_CS1_1;     // Clear Port1 ADC !CS
+   /* The event carries the timestamp of the first sample of the window */
+   if (ports && decimation_counter == 0)
+   {
+      load_cells_sequence = sample_sequence;
+      
+      /* TCC0 has been counting since CONVST, so its count dates the conversion start */
+      uint16_t ticks_since_convst = TCC0.CNT;
+      core_func_mark_user_timestamp();
       
-   for (uint8_t i = 0; i < 4; i++)
+      /* Timestamp's microseconds are counted in steps of 32 us */
+      uint32_t second;
+      uint16_t usecond;
+      uint16_t elapsed = (ticks_since_convst + 16 * SAMPLE_TIMER_TICKS_PER_US) / (32 * SAMPLE_TIMER_TICKS_PER_US);
+      
+      core_func_read_user_timestamp(&second, &usecond);
+      
+      if (usecond < elapsed)
+      {
+         second--;
+         usecond += 31250;
+      }
+      
+      core_func_update_user_timestamp(second, usecond - elapsed);
+   }
+   
+   /* Enable CONVST for the next period on the enabled ports that have a board */
+   sampled_ports = 0;
+   
+   if (app_regs.REG_START)
    {
-      SPIC_DATA = 0;
-      SPID_DATA = 0;
-      //loop_until_bit_is_set(SPIC_STATUS, SPI_IF_bp);
-      loop_until_bit_is_set(SPID_STATUS, SPI_IF_bp);
-         
-      *(((uint8_t*)(&app_regs.REG_LOAD_CELLS[0])) + i*2 + 1) = SPIC_DATA;
-      *(((uint8_t*)(&app_regs.REG_LOAD_CELLS[0])) + i*2 + 9) = SPID_DATA;
-         
-      SPIC_DATA = 0;
-      SPID_DATA = 0;
-      //loop_until_bit_is_set(SPIC_STATUS, SPI_IF_bp);
-      loop_until_bit_is_set(SPID_STATUS, SPI_IF_bp);
-         
-      *(((uint8_t*)(&app_regs.REG_LOAD_CELLS[0])) + i*2 + 0) = SPIC_DATA;
-      *(((uint8_t*)(&app_regs.REG_LOAD_CELLS[0])) + i*2 + 8) = SPID_DATA;
-   }      
+      if ((app_regs.REG_PORTS_ENABLE & B_PORT0) && read_CS0_1) sampled_ports |= B_PORT0;
+      if ((app_regs.REG_PORTS_ENABLE & B_PORT1) && read_CS1_1) sampled_ports |= B_PORT1;
+   }
+   
+   if (sampled_ports & B_PORT0) TCC0.CTRLB |= TC0_CCAEN_bm; else TCC0.CTRLB &= ~TC0_CCAEN_bm;
+   if (sampled_ports & B_PORT1) TCD0.CTRLB |= TC0_CCAEN_bm; else TCD0.CTRLB &= ~TC0_CCAEN_bm;
+   
+   if (!ports)
+   {
+      reti();
+   }
+   
+   /* Disabled ports are handled as if they had no board */
+   port0_has_board = ((ports & B_PORT0) && read_CS0_1) ? true : false;
+   port1_has_board = ((ports & B_PORT1) && read_CS1_1) ? true : false;
+   
+   /* Set before !CS goes low, so the pots keep off the SPI from here on */
+   adc_dma_pending = ports;
+   
+   if (ports & B_PORT0) clr_CS0_1;     // Clear Port0 ADC !CS
+   if (ports & B_PORT1) clr_CS1_1;     // Clear Port1 ADC !CS
+   
+   /* The bytes are read by the DMA, the CPU is free until DMA_CH0_vect and DMA_CH2_vect */
+   adc_dma_start(ports);
+   
+   reti();
+}
 
-   clr_CS0_0;     // CLear Port0 ADC CONVST
-   clr_CS1_0;     // CLear Port1 ADC CONVST
-   set_CS0_1;     // Set Port0 ADC !CS
-   set_CS1_1;     // Set Port1 ADC !CS
+/************************************************************************/
+/* ADC readout completed                                                */
+/************************************************************************/
+void adc_readout_completed(void)
+{
+   int16_t sample[8];
    
-   //--------------------------------------------------------------------(B)
+   app_regs.REG_PERF_COUNTERS[PERF_SAMPLES_ACQUIRED]++;
+   
+   /* The ADCs send the MSB first */
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      sample[i] = (int16_t)((adc_dma_buffer[i*2] << 8) | adc_dma_buffer[i*2 + 1]);
+   }
    
    if (!port0_has_board)
    {
-      app_regs.REG_LOAD_CELLS[0] = 0;
-      app_regs.REG_LOAD_CELLS[1] = 0;
-      app_regs.REG_LOAD_CELLS[2] = 0;
-      app_regs.REG_LOAD_CELLS[3] = 0;
+      sample[0] = 0;
+      sample[1] = 0;
+      sample[2] = 0;
+      sample[3] = 0;
    }
    
    if (!port1_has_board)
    {
-      app_regs.REG_LOAD_CELLS[4] = 0;
-      app_regs.REG_LOAD_CELLS[5] = 0;
-      app_regs.REG_LOAD_CELLS[6] = 0;
-      app_regs.REG_LOAD_CELLS[7] = 0;
+      sample[4] = 0;
+      sample[5] = 0;
+      sample[6] = 0;
+      sample[7] = 0;
+   }
+   
+   process_auto_zero(sample, (port0_has_board ? 0x0F : 0) | (port1_has_board ? 0xF0 : 0));
+   
+   /* The thresholds and the reported channels each use the filtered sample or the raw one */
+   int16_t * filtered = sample;
+   
+   if (app_regs.REG_FILTER_MODE != GM_FILTER_NONE)
+   {
+      process_filter(sample);
+      filtered = filter_output;
+   }
+   
+   int16_t * thresholds_input = (app_regs.REG_FILTER_TARGETS & B_FILTER_THRESHOLDS) ? filtered : sample;
+   int16_t * reported = (app_regs.REG_FILTER_TARGETS & B_FILTER_LOAD_CELLS) ? filtered : sample;
+   
+   /* Drive the outputs before anything else is done with the sample */
+   if (app_regs.REG_THRESHOLDS_MODE == GM_THRESHOLDS_LOW_LATENCY)
+   {
+      process_thresholds(thresholds_input);
+   }
+   
+   /* Boxcar average over 2^REG_DECIMATION samples */
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      decimation_accumulator[i] += reported[i];
+   }
+   
+   if (++decimation_counter < (1 << app_regs.REG_DECIMATION))
+   {
+      return;
+   }
+   
+   for (uint8_t i = 0; i < 8; i++)
+   {
+      app_regs.REG_LOAD_CELLS[i] = (int16_t)(decimation_accumulator[i] >> app_regs.REG_DECIMATION);
+      decimation_accumulator[i] = 0;
+   }
+   
+   decimation_counter = 0;
+   
+   if (app_regs.REG_SEQUENCE_ENABLE)
+   {
+      update_load_cells_frame();
    }
    
    if (app_regs.REG_EVNT_ENABLE & B_EVT_LOAD_CELLS)
    {
-      core_func_send_event(ADD_REG_LOAD_CELLS, false);      
+      send_load_cells_event();
+   }
+   
+   if (app_regs.REG_EVNT_ENABLE & B_EVT_LOAD_CELLS_VIRTUAL)
+   {
+      compute_virtual_channels(app_regs.REG_LOAD_CELLS, app_regs.REG_LOAD_CELLS_VIRTUAL);
+      send_event_if_room(ADD_REG_LOAD_CELLS_VIRTUAL, false);
+   }
+   
+   if (app_regs.REG_EVNT_ENABLE & B_EVT_LOAD_CELLS_BATCH)
+   {
+      if (batch_counter == 0)
+      {
+         core_func_read_user_timestamp(&batch_second, &batch_usecond);
+      }
+      
+      /* Each frame has the same channels as the LOAD_CELLS event */
+      int16_t * frame = (int16_t*)(app_regs_pointer[ADD_REG_LOAD_CELLS - APP_REGS_ADD_MIN]);
+      uint8_t frame_length = app_regs_n_elements[ADD_REG_LOAD_CELLS - APP_REGS_ADD_MIN];
+      
+      for (uint8_t i = 0; i < frame_length; i++)
+      {
+         app_regs.REG_LOAD_CELLS_BATCH[batch_counter*frame_length + i] = frame[i];
+      }
+      
+      /* With the sequence number, fewer frames fit in the register */
+      if (++batch_counter >= app_regs.REG_BATCH_SIZE || (batch_counter + 1) * frame_length > 8*BATCH_SIZE_MAX)
+      {
+         /* Only the filled frames are sent */
+         app_regs_n_elements[ADD_REG_LOAD_CELLS_BATCH - APP_REGS_ADD_MIN] = batch_counter * frame_length;
+         
+         core_func_update_user_timestamp(batch_second, batch_usecond);
+         send_event_if_room(ADD_REG_LOAD_CELLS_BATCH, false);
+         
+         batch_counter = 0;
+      }
+   }
+   
+   /* The thresholds are evaluated once per reported sample */
+   /* When only one side is filtered, the thresholds see the last sample of the window instead */
+   if (app_regs.REG_THRESHOLDS_MODE == GM_THRESHOLDS_DECIMATED)
+   {
+      process_thresholds((thresholds_input == reported) ? app_regs.REG_LOAD_CELLS : thresholds_input);
+   }
+}
+
+/* Port0 received the 8 bytes */
+ISR(DMA_CH0_vect, ISR_NAKED)
+{
+   DMA.CH0.CTRLB |= DMA_CH_TRNIF_bm;
+   
+   set_CS0_1;     // Set Port0 ADC !CS
+   
+   adc_dma_pending &= ~B_PORT0;
+   
+   if (adc_dma_pending == 0)
+   {
+      uint16_t start = TCC0.CNT;
+      adc_readout_completed();
+      perf_keep_max_cycles(PERF_READOUT_MAX_CYCLES, sample_timer_elapsed(start));
+   }
+   
+   reti();
+}
+
+/* Port1 received the 8 bytes */
+ISR(DMA_CH2_vect, ISR_NAKED)
+{
+   DMA.CH2.CTRLB |= DMA_CH_TRNIF_bm;
+   
+   set_CS1_1;     // Set Port1 ADC !CS
+   
+   adc_dma_pending &= ~B_PORT1;
+   
+   if (adc_dma_pending == 0)
+   {
+      uint16_t start = TCC0.CNT;
+      adc_readout_completed();
+      perf_keep_max_cycles(PERF_READOUT_MAX_CYCLES, sample_timer_elapsed(start));
    }
    
    reti();
@@ -95,7 +95,41 @@ namespace Harp.LoadCells
             { 87, typeof(DO6TimeBelowThreshold) },
             { 88, typeof(DO7TimeBelowThreshold) },
             { 89, typeof(DO8TimeBelowThreshold) },
-            { 90, typeof(EnableEvents) }
+            { 90, typeof(EnableEvents) },
+            { 91, typeof(SampleRate) },
+            { 92, typeof(Decimation) },
+            { 93, typeof(LoadCellDataBatch) },
+            { 94, typeof(BatchSize) },
+            { 95, typeof(EnablePorts) },
+            { 96, typeof(ThresholdsMode) },
+            { 97, typeof(ThresholdsLatency) },
+            { 98, typeof(AutoZero) },
+            { 99, typeof(PerformanceCounters) },
+            { 100, typeof(EnableSequence) },
+            { 101, typeof(DeltaKeyframeInterval) },
+            { 102, typeof(LoadCellDataDelta) },
+            { 103, typeof(Deadband) },
+            { 104, typeof(DeadbandHeartbeat) },
+            { 105, typeof(FilterMode) },
+            { 106, typeof(FilterLength) },
+            { 107, typeof(FilterChannels) },
+            { 108, typeof(FilterTargets) },
+            { 109, typeof(VirtualChannelWeights) },
+            { 110, typeof(VirtualChannelShift) },
+            { 111, typeof(LoadCellDataVirtual) },
+            { 112, typeof(ThresholdComparator) },
+            { 113, typeof(ThresholdLow) },
+            { 114, typeof(ThresholdSlopeSamples) },
+            { 115, typeof(ThresholdLogic) },
+            { 116, typeof(ThresholdLogicInputs) },
+            { 117, typeof(PulseWidth) },
+            { 118, typeof(PulsePeriod) },
+            { 119, typeof(PulseCount) },
+            { 120, typeof(DoSchedule) },
+            { 121, typeof(DoScheduleLength) },
+            { 122, typeof(DoScheduleStartTime) },
+            { 123, typeof(DoScheduleStart) },
+            { 124, typeof(DigitalInputEdge) }
         };
 
         /// <summary>
@@ -211,6 +245,40 @@ namespace Harp.LoadCells
     /// <seealso cref="DO7TimeBelowThreshold"/>
     /// <seealso cref="DO8TimeBelowThreshold"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="SampleRate"/>
+    /// <seealso cref="Decimation"/>
+    /// <seealso cref="LoadCellDataBatch"/>
+    /// <seealso cref="BatchSize"/>
+    /// <seealso cref="EnablePorts"/>
+    /// <seealso cref="ThresholdsMode"/>
+    /// <seealso cref="ThresholdsLatency"/>
+    /// <seealso cref="AutoZero"/>
+    /// <seealso cref="PerformanceCounters"/>
+    /// <seealso cref="EnableSequence"/>
+    /// <seealso cref="DeltaKeyframeInterval"/>
+    /// <seealso cref="LoadCellDataDelta"/>
+    /// <seealso cref="Deadband"/>
+    /// <seealso cref="DeadbandHeartbeat"/>
+    /// <seealso cref="FilterMode"/>
+    /// <seealso cref="FilterLength"/>
+    /// <seealso cref="FilterChannels"/>
+    /// <seealso cref="FilterTargets"/>
+    /// <seealso cref="VirtualChannelWeights"/>
+    /// <seealso cref="VirtualChannelShift"/>
+    /// <seealso cref="LoadCellDataVirtual"/>
+    /// <seealso cref="ThresholdComparator"/>
+    /// <seealso cref="ThresholdLow"/>
+    /// <seealso cref="ThresholdSlopeSamples"/>
+    /// <seealso cref="ThresholdLogic"/>
+    /// <seealso cref="ThresholdLogicInputs"/>
+    /// <seealso cref="PulseWidth"/>
+    /// <seealso cref="PulsePeriod"/>
+    /// <seealso cref="PulseCount"/>
+    /// <seealso cref="DoSchedule"/>
+    /// <seealso cref="DoScheduleLength"/>
+    /// <seealso cref="DoScheduleStartTime"/>
+    /// <seealso cref="DoScheduleStart"/>
+    /// <seealso cref="DigitalInputEdge"/>
     [XmlInclude(typeof(AcquisitionState))]
     [XmlInclude(typeof(LoadCellData))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -263,6 +331,40 @@ namespace Harp.LoadCells
     [XmlInclude(typeof(DO7TimeBelowThreshold))]
     [XmlInclude(typeof(DO8TimeBelowThreshold))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(SampleRate))]
+    [XmlInclude(typeof(Decimation))]
+    [XmlInclude(typeof(LoadCellDataBatch))]
+    [XmlInclude(typeof(BatchSize))]
+    [XmlInclude(typeof(EnablePorts))]
+    [XmlInclude(typeof(ThresholdsMode))]
+    [XmlInclude(typeof(ThresholdsLatency))]
+    [XmlInclude(typeof(AutoZero))]
+    [XmlInclude(typeof(PerformanceCounters))]
+    [XmlInclude(typeof(EnableSequence))]
+    [XmlInclude(typeof(DeltaKeyframeInterval))]
+    [XmlInclude(typeof(LoadCellDataDelta))]
+    [XmlInclude(typeof(Deadband))]
+    [XmlInclude(typeof(DeadbandHeartbeat))]
+    [XmlInclude(typeof(FilterMode))]
+    [XmlInclude(typeof(FilterLength))]
+    [XmlInclude(typeof(FilterChannels))]
+    [XmlInclude(typeof(FilterTargets))]
+    [XmlInclude(typeof(VirtualChannelWeights))]
+    [XmlInclude(typeof(VirtualChannelShift))]
+    [XmlInclude(typeof(LoadCellDataVirtual))]
+    [XmlInclude(typeof(ThresholdComparator))]
+    [XmlInclude(typeof(ThresholdLow))]
+    [XmlInclude(typeof(ThresholdSlopeSamples))]
+    [XmlInclude(typeof(ThresholdLogic))]
+    [XmlInclude(typeof(ThresholdLogicInputs))]
+    [XmlInclude(typeof(PulseWidth))]
+    [XmlInclude(typeof(PulsePeriod))]
+    [XmlInclude(typeof(PulseCount))]
+    [XmlInclude(typeof(DoSchedule))]
+    [XmlInclude(typeof(DoScheduleLength))]
+    [XmlInclude(typeof(DoScheduleStartTime))]
+    [XmlInclude(typeof(DoScheduleStart))]
+    [XmlInclude(typeof(DigitalInputEdge))]
     [Description("Filters register-specific messages reported by the LoadCells device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -336,6 +438,40 @@ namespace Harp.LoadCells
     /// <seealso cref="DO7TimeBelowThreshold"/>
     /// <seealso cref="DO8TimeBelowThreshold"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="SampleRate"/>
+    /// <seealso cref="Decimation"/>
+    /// <seealso cref="LoadCellDataBatch"/>
+    /// <seealso cref="BatchSize"/>
+    /// <seealso cref="EnablePorts"/>
+    /// <seealso cref="ThresholdsMode"/>
+    /// <seealso cref="ThresholdsLatency"/>
+    /// <seealso cref="AutoZero"/>
+    /// <seealso cref="PerformanceCounters"/>
+    /// <seealso cref="EnableSequence"/>
+    /// <seealso cref="DeltaKeyframeInterval"/>
+    /// <seealso cref="LoadCellDataDelta"/>
+    /// <seealso cref="Deadband"/>
+    /// <seealso cref="DeadbandHeartbeat"/>
+    /// <seealso cref="FilterMode"/>
+    /// <seealso cref="FilterLength"/>
+    /// <seealso cref="FilterChannels"/>
+    /// <seealso cref="FilterTargets"/>
+    /// <seealso cref="VirtualChannelWeights"/>
+    /// <seealso cref="VirtualChannelShift"/>
+    /// <seealso cref="LoadCellDataVirtual"/>
+    /// <seealso cref="ThresholdComparator"/>
+    /// <seealso cref="ThresholdLow"/>
+    /// <seealso cref="ThresholdSlopeSamples"/>
+    /// <seealso cref="ThresholdLogic"/>
+    /// <seealso cref="ThresholdLogicInputs"/>
+    /// <seealso cref="PulseWidth"/>
+    /// <seealso cref="PulsePeriod"/>
+    /// <seealso cref="PulseCount"/>
+    /// <seealso cref="DoSchedule"/>
+    /// <seealso cref="DoScheduleLength"/>
+    /// <seealso cref="DoScheduleStartTime"/>
+    /// <seealso cref="DoScheduleStart"/>
+    /// <seealso cref="DigitalInputEdge"/>
     [XmlInclude(typeof(AcquisitionState))]
     [XmlInclude(typeof(LoadCellData))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -388,6 +524,40 @@ namespace Harp.LoadCells
     [XmlInclude(typeof(DO7TimeBelowThreshold))]
     [XmlInclude(typeof(DO8TimeBelowThreshold))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(SampleRate))]
+    [XmlInclude(typeof(Decimation))]
+    [XmlInclude(typeof(LoadCellDataBatch))]
+    [XmlInclude(typeof(BatchSize))]
+    [XmlInclude(typeof(EnablePorts))]
+    [XmlInclude(typeof(ThresholdsMode))]
+    [XmlInclude(typeof(ThresholdsLatency))]
+    [XmlInclude(typeof(AutoZero))]
+    [XmlInclude(typeof(PerformanceCounters))]
+    [XmlInclude(typeof(EnableSequence))]
+    [XmlInclude(typeof(DeltaKeyframeInterval))]
+    [XmlInclude(typeof(LoadCellDataDelta))]
+    [XmlInclude(typeof(Deadband))]
+    [XmlInclude(typeof(DeadbandHeartbeat))]
+    [XmlInclude(typeof(FilterMode))]
+    [XmlInclude(typeof(FilterLength))]
+    [XmlInclude(typeof(FilterChannels))]
+    [XmlInclude(typeof(FilterTargets))]
+    [XmlInclude(typeof(VirtualChannelWeights))]
+    [XmlInclude(typeof(VirtualChannelShift))]
+    [XmlInclude(typeof(LoadCellDataVirtual))]
+    [XmlInclude(typeof(ThresholdComparator))]
+    [XmlInclude(typeof(ThresholdLow))]
+    [XmlInclude(typeof(ThresholdSlopeSamples))]
+    [XmlInclude(typeof(ThresholdLogic))]
+    [XmlInclude(typeof(ThresholdLogicInputs))]
+    [XmlInclude(typeof(PulseWidth))]
+    [XmlInclude(typeof(PulsePeriod))]
+    [XmlInclude(typeof(PulseCount))]
+    [XmlInclude(typeof(DoSchedule))]
+    [XmlInclude(typeof(DoScheduleLength))]
+    [XmlInclude(typeof(DoScheduleStartTime))]
+    [XmlInclude(typeof(DoScheduleStart))]
+    [XmlInclude(typeof(DigitalInputEdge))]
     [XmlInclude(typeof(TimestampedAcquisitionState))]
     [XmlInclude(typeof(TimestampedLoadCellData))]
     [XmlInclude(typeof(TimestampedDigitalInputState))]
@@ -440,6 +610,40 @@ namespace Harp.LoadCells
     [XmlInclude(typeof(TimestampedDO7TimeBelowThreshold))]
     [XmlInclude(typeof(TimestampedDO8TimeBelowThreshold))]
     [XmlInclude(typeof(TimestampedEnableEvents))]
+    [XmlInclude(typeof(TimestampedSampleRate))]
+    [XmlInclude(typeof(TimestampedDecimation))]
+    [XmlInclude(typeof(TimestampedLoadCellDataBatch))]
+    [XmlInclude(typeof(TimestampedBatchSize))]
+    [XmlInclude(typeof(TimestampedEnablePorts))]
+    [XmlInclude(typeof(TimestampedThresholdsMode))]
+    [XmlInclude(typeof(TimestampedThresholdsLatency))]
+    [XmlInclude(typeof(TimestampedAutoZero))]
+    [XmlInclude(typeof(TimestampedPerformanceCounters))]
+    [XmlInclude(typeof(TimestampedEnableSequence))]
+    [XmlInclude(typeof(TimestampedDeltaKeyframeInterval))]
+    [XmlInclude(typeof(TimestampedLoadCellDataDelta))]
+    [XmlInclude(typeof(TimestampedDeadband))]
+    [XmlInclude(typeof(TimestampedDeadbandHeartbeat))]
+    [XmlInclude(typeof(TimestampedFilterMode))]
+    [XmlInclude(typeof(TimestampedFilterLength))]
+    [XmlInclude(typeof(TimestampedFilterChannels))]
+    [XmlInclude(typeof(TimestampedFilterTargets))]
+    [XmlInclude(typeof(TimestampedVirtualChannelWeights))]
+    [XmlInclude(typeof(TimestampedVirtualChannelShift))]
+    [XmlInclude(typeof(TimestampedLoadCellDataVirtual))]
+    [XmlInclude(typeof(TimestampedThresholdComparator))]
+    [XmlInclude(typeof(TimestampedThresholdLow))]
+    [XmlInclude(typeof(TimestampedThresholdSlopeSamples))]
+    [XmlInclude(typeof(TimestampedThresholdLogic))]
+    [XmlInclude(typeof(TimestampedThresholdLogicInputs))]
+    [XmlInclude(typeof(TimestampedPulseWidth))]
+    [XmlInclude(typeof(TimestampedPulsePeriod))]
+    [XmlInclude(typeof(TimestampedPulseCount))]
+    [XmlInclude(typeof(TimestampedDoSchedule))]
+    [XmlInclude(typeof(TimestampedDoScheduleLength))]
+    [XmlInclude(typeof(TimestampedDoScheduleStartTime))]
+    [XmlInclude(typeof(TimestampedDoScheduleStart))]
+    [XmlInclude(typeof(TimestampedDigitalInputEdge))]
     [Description("Filters and selects specific messages reported by the LoadCells device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -510,6 +714,40 @@ namespace Harp.LoadCells
     /// <seealso cref="DO7TimeBelowThreshold"/>
     /// <seealso cref="DO8TimeBelowThreshold"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="SampleRate"/>
+    /// <seealso cref="Decimation"/>
+    /// <seealso cref="LoadCellDataBatch"/>
+    /// <seealso cref="BatchSize"/>
+    /// <seealso cref="EnablePorts"/>
+    /// <seealso cref="ThresholdsMode"/>
+    /// <seealso cref="ThresholdsLatency"/>
+    /// <seealso cref="AutoZero"/>
+    /// <seealso cref="PerformanceCounters"/>
+    /// <seealso cref="EnableSequence"/>
+    /// <seealso cref="DeltaKeyframeInterval"/>
+    /// <seealso cref="LoadCellDataDelta"/>
+    /// <seealso cref="Deadband"/>
+    /// <seealso cref="DeadbandHeartbeat"/>
+    /// <seealso cref="FilterMode"/>
+    /// <seealso cref="FilterLength"/>
+    /// <seealso cref="FilterChannels"/>
+    /// <seealso cref="FilterTargets"/>
+    /// <seealso cref="VirtualChannelWeights"/>
+    /// <seealso cref="VirtualChannelShift"/>
+    /// <seealso cref="LoadCellDataVirtual"/>
+    /// <seealso cref="ThresholdComparator"/>
+    /// <seealso cref="ThresholdLow"/>
+    /// <seealso cref="ThresholdSlopeSamples"/>
+    /// <seealso cref="ThresholdLogic"/>
+    /// <seealso cref="ThresholdLogicInputs"/>
+    /// <seealso cref="PulseWidth"/>
+    /// <seealso cref="PulsePeriod"/>
+    /// <seealso cref="PulseCount"/>
+    /// <seealso cref="DoSchedule"/>
+    /// <seealso cref="DoScheduleLength"/>
+    /// <seealso cref="DoScheduleStartTime"/>
+    /// <seealso cref="DoScheduleStart"/>
+    /// <seealso cref="DigitalInputEdge"/>
     [XmlInclude(typeof(AcquisitionState))]
     [XmlInclude(typeof(LoadCellData))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -562,6 +800,40 @@ namespace Harp.LoadCells
     [XmlInclude(typeof(DO7TimeBelowThreshold))]
     [XmlInclude(typeof(DO8TimeBelowThreshold))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(SampleRate))]
+    [XmlInclude(typeof(Decimation))]
+    [XmlInclude(typeof(LoadCellDataBatch))]
+    [XmlInclude(typeof(BatchSize))]
+    [XmlInclude(typeof(EnablePorts))]
+    [XmlInclude(typeof(ThresholdsMode))]
+    [XmlInclude(typeof(ThresholdsLatency))]
+    [XmlInclude(typeof(AutoZero))]
+    [XmlInclude(typeof(PerformanceCounters))]
+    [XmlInclude(typeof(EnableSequence))]
+    [XmlInclude(typeof(DeltaKeyframeInterval))]
+    [XmlInclude(typeof(LoadCellDataDelta))]
+    [XmlInclude(typeof(Deadband))]
+    [XmlInclude(typeof(DeadbandHeartbeat))]
+    [XmlInclude(typeof(FilterMode))]
+    [XmlInclude(typeof(FilterLength))]
+    [XmlInclude(typeof(FilterChannels))]
+    [XmlInclude(typeof(FilterTargets))]
+    [XmlInclude(typeof(VirtualChannelWeights))]
+    [XmlInclude(typeof(VirtualChannelShift))]
+    [XmlInclude(typeof(LoadCellDataVirtual))]
+    [XmlInclude(typeof(ThresholdComparator))]
+    [XmlInclude(typeof(ThresholdLow))]
+    [XmlInclude(typeof(ThresholdSlopeSamples))]
+    [XmlInclude(typeof(ThresholdLogic))]
+    [XmlInclude(typeof(ThresholdLogicInputs))]
+    [XmlInclude(typeof(PulseWidth))]
+    [XmlInclude(typeof(PulsePeriod))]
+    [XmlInclude(typeof(PulseCount))]
+    [XmlInclude(typeof(DoSchedule))]
+    [XmlInclude(typeof(DoScheduleLength))]
+    [XmlInclude(typeof(DoScheduleStartTime))]
+    [XmlInclude(typeof(DoScheduleStart))]
+    [XmlInclude(typeof(DigitalInputEdge))]
     [Description("Formats a sequence of values as specific LoadCells register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -674,9 +946,9 @@ namespace Harp.LoadCells
     }
 
     /// <summary>
-    /// Represents a register that value of single ADC read from all load cell channels.
+    /// Represents a register that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.
     /// </summary>
-    [Description("Value of single ADC read from all load cell channels.")]
+    [Description("Value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.")]
     public partial class LoadCellData
     {
         /// <summary>
@@ -5770,3152 +6042,10240 @@ namespace Harp.LoadCells
         }
     }
 
+    /// <summary>
+    /// Represents a register that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.
+    /// </summary>
+    [Description("Specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.")]
+    public partial class SampleRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SampleRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SampleRateConfig GetPayload(HarpMessage message)
+        {
+            return (SampleRateConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SampleRateConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SampleRateConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SampleRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SampleRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SampleRateConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SampleRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SampleRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SampleRateConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SampleRate register.
+    /// </summary>
+    /// <seealso cref="SampleRate"/>
+    [Description("Filters and selects timestamped messages from the SampleRate register.")]
+    public partial class TimestampedSampleRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SampleRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SampleRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SampleRateConfig> GetPayload(HarpMessage message)
+        {
+            return SampleRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.
+    /// </summary>
+    [Description("Specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.")]
+    public partial class Decimation
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Decimation"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Decimation"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Decimation"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Decimation"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DecimationConfig GetPayload(HarpMessage message)
+        {
+            return (DecimationConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Decimation"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DecimationConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DecimationConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Decimation"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Decimation"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DecimationConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Decimation"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Decimation"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DecimationConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Decimation register.
+    /// </summary>
+    /// <seealso cref="Decimation"/>
+    [Description("Filters and selects timestamped messages from the Decimation register.")]
+    public partial class TimestampedDecimation
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Decimation"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Decimation.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Decimation"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DecimationConfig> GetPayload(HarpMessage message)
+        {
+            return Decimation.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.
+    /// </summary>
+    [Description("Consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.")]
+    public partial class LoadCellDataBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadCellDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoadCellDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoadCellDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static short[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<short>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<short>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoadCellDataBatch"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadCellDataBatch"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, short[] value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoadCellDataBatch"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadCellDataBatch"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, short[] value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoadCellDataBatch register.
+    /// </summary>
+    /// <seealso cref="LoadCellDataBatch"/>
+    [Description("Filters and selects timestamped messages from the LoadCellDataBatch register.")]
+    public partial class TimestampedLoadCellDataBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadCellDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoadCellDataBatch.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<short[]> GetPayload(HarpMessage message)
+        {
+            return LoadCellDataBatch.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.
+    /// </summary>
+    [Description("Specifies the number of LoadCellData frames included in each LoadCellDataBatch event.")]
+    public partial class BatchSize
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="BatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="BatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="BatchSize"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BatchSize"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="BatchSize"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="BatchSize"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// BatchSize register.
+    /// </summary>
+    /// <seealso cref="BatchSize"/>
+    [Description("Filters and selects timestamped messages from the BatchSize register.")]
+    public partial class TimestampedBatchSize
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="BatchSize"/> register. This field is constant.
+        /// </summary>
+        public const int Address = BatchSize.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="BatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return BatchSize.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.
+    /// </summary>
+    [Description("Specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.")]
+    public partial class EnablePorts
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnablePorts"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnablePorts"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnablePorts"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnablePorts"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static LoadCellPorts GetPayload(HarpMessage message)
+        {
+            return (LoadCellPorts)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnablePorts"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellPorts> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((LoadCellPorts)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnablePorts"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnablePorts"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, LoadCellPorts value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnablePorts"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnablePorts"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, LoadCellPorts value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnablePorts register.
+    /// </summary>
+    /// <seealso cref="EnablePorts"/>
+    [Description("Filters and selects timestamped messages from the EnablePorts register.")]
+    public partial class TimestampedEnablePorts
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnablePorts"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnablePorts.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnablePorts"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellPorts> GetPayload(HarpMessage message)
+        {
+            return EnablePorts.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.
+    /// </summary>
+    [Description("Specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.")]
+    public partial class ThresholdsMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdsMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdsMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdsMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdsMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdsModeConfig GetPayload(HarpMessage message)
+        {
+            return (ThresholdsModeConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdsMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdsModeConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ThresholdsModeConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdsMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdsMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdsModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdsMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdsMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdsModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdsMode register.
+    /// </summary>
+    /// <seealso cref="ThresholdsMode"/>
+    [Description("Filters and selects timestamped messages from the ThresholdsMode register.")]
+    public partial class TimestampedThresholdsMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdsMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdsMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdsMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdsModeConfig> GetPayload(HarpMessage message)
+        {
+            return ThresholdsMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.
+    /// </summary>
+    [Description("Time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.")]
+    public partial class ThresholdsLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdsLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdsLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdsLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdsLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdsLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdsLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdsLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdsLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdsLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdsLatency register.
+    /// </summary>
+    /// <seealso cref="ThresholdsLatency"/>
+    [Description("Filters and selects timestamped messages from the ThresholdsLatency register.")]
+    public partial class TimestampedThresholdsLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdsLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdsLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdsLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ThresholdsLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.
+    /// </summary>
+    [Description("Starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.")]
+    public partial class AutoZero
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AutoZero"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AutoZero"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AutoZero"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AutoZero"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static LoadCellChannels GetPayload(HarpMessage message)
+        {
+            return (LoadCellChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AutoZero"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((LoadCellChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AutoZero"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AutoZero"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, LoadCellChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AutoZero"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AutoZero"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, LoadCellChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AutoZero register.
+    /// </summary>
+    /// <seealso cref="AutoZero"/>
+    [Description("Filters and selects timestamped messages from the AutoZero register.")]
+    public partial class TimestampedAutoZero
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AutoZero"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AutoZero.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AutoZero"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellChannels> GetPayload(HarpMessage message)
+        {
+            return AutoZero.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that counters of how close the device is to its limits. Writing any value resets all of them.
+    /// </summary>
+    [Description("Counters of how close the device is to its limits. Writing any value resets all of them.")]
+    public partial class PerformanceCounters
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PerformanceCounters"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PerformanceCounters"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PerformanceCounters"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static PerformanceCountersPayload ParsePayload(uint[] payload)
+        {
+            PerformanceCountersPayload result;
+            result.SamplesAcquired = payload[0];
+            result.SamplesDropped = payload[1];
+            result.EventsDropped = payload[2];
+            result.ReadoutMaxCycles = payload[3];
+            result.ThresholdsMaxCycles = payload[4];
+            result.TransmitBufferMax = payload[5];
+            result.DigitalInputEdgesDropped = payload[6];
+            result.ScheduleEntriesMerged = payload[7];
+            return result;
+        }
+
+        static uint[] FormatPayload(PerformanceCountersPayload value)
+        {
+            uint[] result;
+            result = new uint[8];
+            result[0] = value.SamplesAcquired;
+            result[1] = value.SamplesDropped;
+            result[2] = value.EventsDropped;
+            result[3] = value.ReadoutMaxCycles;
+            result[4] = value.ThresholdsMaxCycles;
+            result[5] = value.TransmitBufferMax;
+            result[6] = value.DigitalInputEdgesDropped;
+            result[7] = value.ScheduleEntriesMerged;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PerformanceCounters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PerformanceCountersPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PerformanceCounters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PerformanceCountersPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PerformanceCounters"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PerformanceCounters"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PerformanceCountersPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PerformanceCounters"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PerformanceCounters"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PerformanceCountersPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PerformanceCounters register.
+    /// </summary>
+    /// <seealso cref="PerformanceCounters"/>
+    [Description("Filters and selects timestamped messages from the PerformanceCounters register.")]
+    public partial class TimestampedPerformanceCounters
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PerformanceCounters"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PerformanceCounters.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PerformanceCounters"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PerformanceCountersPayload> GetPayload(HarpMessage message)
+        {
+            return PerformanceCounters.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.
+    /// </summary>
+    [Description("Appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.")]
+    public partial class EnableSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnableSequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnableSequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnableSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnableSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnableSequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableSequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnableSequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableSequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnableSequence register.
+    /// </summary>
+    /// <seealso cref="EnableSequence"/>
+    [Description("Filters and selects timestamped messages from the EnableSequence register.")]
+    public partial class TimestampedEnableSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnableSequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnableSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return EnableSequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.
+    /// </summary>
+    [Description("Specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.")]
+    public partial class DeltaKeyframeInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeltaKeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DeltaKeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DeltaKeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DeltaKeyframeInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DeltaKeyframeInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DeltaKeyframeInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeltaKeyframeInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DeltaKeyframeInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeltaKeyframeInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DeltaKeyframeInterval register.
+    /// </summary>
+    /// <seealso cref="DeltaKeyframeInterval"/>
+    [Description("Filters and selects timestamped messages from the DeltaKeyframeInterval register.")]
+    public partial class TimestampedDeltaKeyframeInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeltaKeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DeltaKeyframeInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DeltaKeyframeInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DeltaKeyframeInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.
+    /// </summary>
+    [Description("Difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.")]
+    public partial class LoadCellDataDelta
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadCellDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoadCellDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoadCellDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoadCellDataDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static sbyte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<sbyte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoadCellDataDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<sbyte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<sbyte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoadCellDataDelta"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadCellDataDelta"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, sbyte[] value)
+        {
+            return HarpMessage.FromSByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoadCellDataDelta"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadCellDataDelta"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, sbyte[] value)
+        {
+            return HarpMessage.FromSByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoadCellDataDelta register.
+    /// </summary>
+    /// <seealso cref="LoadCellDataDelta"/>
+    [Description("Filters and selects timestamped messages from the LoadCellDataDelta register.")]
+    public partial class TimestampedLoadCellDataDelta
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadCellDataDelta"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoadCellDataDelta.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoadCellDataDelta"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<sbyte[]> GetPayload(HarpMessage message)
+        {
+            return LoadCellDataDelta.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.
+    /// </summary>
+    [Description("Change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.")]
+    public partial class Deadband
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Deadband"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Deadband"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Deadband"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Deadband"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Deadband"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Deadband"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Deadband"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Deadband"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Deadband"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Deadband register.
+    /// </summary>
+    /// <seealso cref="Deadband"/>
+    [Description("Filters and selects timestamped messages from the Deadband register.")]
+    public partial class TimestampedDeadband
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Deadband"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Deadband.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Deadband"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Deadband.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.
+    /// </summary>
+    [Description("Maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.")]
+    public partial class DeadbandHeartbeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeadbandHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DeadbandHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DeadbandHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DeadbandHeartbeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DeadbandHeartbeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DeadbandHeartbeat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeadbandHeartbeat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DeadbandHeartbeat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeadbandHeartbeat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DeadbandHeartbeat register.
+    /// </summary>
+    /// <seealso cref="DeadbandHeartbeat"/>
+    [Description("Filters and selects timestamped messages from the DeadbandHeartbeat register.")]
+    public partial class TimestampedDeadbandHeartbeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeadbandHeartbeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DeadbandHeartbeat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DeadbandHeartbeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DeadbandHeartbeat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the filter applied to each sample of the filtered channels, right after it is read.
+    /// </summary>
+    [Description("Specifies the filter applied to each sample of the filtered channels, right after it is read.")]
+    public partial class FilterMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FilterMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FilterMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FilterMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FilterModeConfig GetPayload(HarpMessage message)
+        {
+            return (FilterModeConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FilterMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FilterModeConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FilterModeConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FilterMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FilterModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FilterMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FilterModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FilterMode register.
+    /// </summary>
+    /// <seealso cref="FilterMode"/>
+    [Description("Filters and selects timestamped messages from the FilterMode register.")]
+    public partial class TimestampedFilterMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FilterMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FilterMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FilterModeConfig> GetPayload(HarpMessage message)
+        {
+            return FilterMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.
+    /// </summary>
+    [Description("Base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.")]
+    public partial class FilterLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FilterLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FilterLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FilterLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FilterLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FilterLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FilterLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FilterLength register.
+    /// </summary>
+    /// <seealso cref="FilterLength"/>
+    [Description("Filters and selects timestamped messages from the FilterLength register.")]
+    public partial class TimestampedFilterLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FilterLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FilterLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return FilterLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the channels that are filtered.
+    /// </summary>
+    [Description("Specifies the channels that are filtered.")]
+    public partial class FilterChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FilterChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FilterChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FilterChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static LoadCellChannels GetPayload(HarpMessage message)
+        {
+            return (LoadCellChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FilterChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((LoadCellChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FilterChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, LoadCellChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FilterChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, LoadCellChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FilterChannels register.
+    /// </summary>
+    /// <seealso cref="FilterChannels"/>
+    [Description("Filters and selects timestamped messages from the FilterChannels register.")]
+    public partial class TimestampedFilterChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FilterChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FilterChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellChannels> GetPayload(HarpMessage message)
+        {
+            return FilterChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies whether the thresholds and the reported load cell data use the filtered channels.
+    /// </summary>
+    [Description("Specifies whether the thresholds and the reported load cell data use the filtered channels.")]
+    public partial class FilterTargets
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterTargets"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 108;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FilterTargets"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FilterTargets"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FilterTargets"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FilterTargets GetPayload(HarpMessage message)
+        {
+            return (FilterTargets)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FilterTargets"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FilterTargets> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FilterTargets)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FilterTargets"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterTargets"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FilterTargets value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FilterTargets"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FilterTargets"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FilterTargets value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FilterTargets register.
+    /// </summary>
+    /// <seealso cref="FilterTargets"/>
+    [Description("Filters and selects timestamped messages from the FilterTargets register.")]
+    public partial class TimestampedFilterTargets
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FilterTargets"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FilterTargets.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FilterTargets"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FilterTargets> GetPayload(HarpMessage message)
+        {
+            return FilterTargets.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.
+    /// </summary>
+    [Description("Weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.")]
+    public partial class VirtualChannelWeights
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualChannelWeights"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 109;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualChannelWeights"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualChannelWeights"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualChannelWeights"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static sbyte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<sbyte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualChannelWeights"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<sbyte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<sbyte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualChannelWeights"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualChannelWeights"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, sbyte[] value)
+        {
+            return HarpMessage.FromSByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualChannelWeights"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualChannelWeights"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, sbyte[] value)
+        {
+            return HarpMessage.FromSByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualChannelWeights register.
+    /// </summary>
+    /// <seealso cref="VirtualChannelWeights"/>
+    [Description("Filters and selects timestamped messages from the VirtualChannelWeights register.")]
+    public partial class TimestampedVirtualChannelWeights
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualChannelWeights"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualChannelWeights.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualChannelWeights"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<sbyte[]> GetPayload(HarpMessage message)
+        {
+            return VirtualChannelWeights.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.
+    /// </summary>
+    [Description("Number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.")]
+    public partial class VirtualChannelShift
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualChannelShift"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 110;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="VirtualChannelShift"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="VirtualChannelShift"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="VirtualChannelShift"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="VirtualChannelShift"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="VirtualChannelShift"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualChannelShift"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="VirtualChannelShift"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="VirtualChannelShift"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// VirtualChannelShift register.
+    /// </summary>
+    /// <seealso cref="VirtualChannelShift"/>
+    [Description("Filters and selects timestamped messages from the VirtualChannelShift register.")]
+    public partial class TimestampedVirtualChannelShift
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="VirtualChannelShift"/> register. This field is constant.
+        /// </summary>
+        public const int Address = VirtualChannelShift.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="VirtualChannelShift"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return VirtualChannelShift.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that virtual channels computed from each LoadCellData frame, with the same timestamp.
+    /// </summary>
+    [Description("Virtual channels computed from each LoadCellData frame, with the same timestamp.")]
+    public partial class LoadCellDataVirtual
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadCellDataVirtual"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 111;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoadCellDataVirtual"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoadCellDataVirtual"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static LoadCellDataVirtualPayload ParsePayload(short[] payload)
+        {
+            LoadCellDataVirtualPayload result;
+            result.Virtual0 = payload[0];
+            result.Virtual1 = payload[1];
+            result.Virtual2 = payload[2];
+            result.Virtual3 = payload[3];
+            return result;
+        }
+
+        static short[] FormatPayload(LoadCellDataVirtualPayload value)
+        {
+            short[] result;
+            result = new short[4];
+            result[0] = value.Virtual0;
+            result[1] = value.Virtual1;
+            result[2] = value.Virtual2;
+            result[3] = value.Virtual3;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoadCellDataVirtual"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static LoadCellDataVirtualPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<short>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoadCellDataVirtual"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellDataVirtualPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<short>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoadCellDataVirtual"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadCellDataVirtual"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, LoadCellDataVirtualPayload value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoadCellDataVirtual"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoadCellDataVirtual"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, LoadCellDataVirtualPayload value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoadCellDataVirtual register.
+    /// </summary>
+    /// <seealso cref="LoadCellDataVirtual"/>
+    [Description("Filters and selects timestamped messages from the LoadCellDataVirtual register.")]
+    public partial class TimestampedLoadCellDataVirtual
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoadCellDataVirtual"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoadCellDataVirtual.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoadCellDataVirtual"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LoadCellDataVirtualPayload> GetPayload(HarpMessage message)
+        {
+            return LoadCellDataVirtual.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.
+    /// </summary>
+    [Description("Comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.")]
+    public partial class ThresholdComparator
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdComparator"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 112;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdComparator"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdComparator"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static ThresholdComparatorPayload ParsePayload(byte[] payload)
+        {
+            ThresholdComparatorPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static byte[] FormatPayload(ThresholdComparatorPayload value)
+        {
+            byte[] result;
+            result = new byte[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdComparator"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdComparatorPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdComparator"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdComparatorPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdComparator"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdComparator"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdComparatorPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdComparator"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdComparator"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdComparatorPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdComparator register.
+    /// </summary>
+    /// <seealso cref="ThresholdComparator"/>
+    [Description("Filters and selects timestamped messages from the ThresholdComparator register.")]
+    public partial class TimestampedThresholdComparator
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdComparator"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdComparator.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdComparator"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdComparatorPayload> GetPayload(HarpMessage message)
+        {
+            return ThresholdComparator.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.
+    /// </summary>
+    [Description("Lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.")]
+    public partial class ThresholdLow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdLow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 113;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdLow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdLow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static ThresholdLowPayload ParsePayload(short[] payload)
+        {
+            ThresholdLowPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static short[] FormatPayload(ThresholdLowPayload value)
+        {
+            short[] result;
+            result = new short[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdLowPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<short>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdLowPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<short>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdLow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdLow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdLowPayload value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdLow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdLow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdLowPayload value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdLow register.
+    /// </summary>
+    /// <seealso cref="ThresholdLow"/>
+    [Description("Filters and selects timestamped messages from the ThresholdLow register.")]
+    public partial class TimestampedThresholdLow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdLow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdLow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdLow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdLowPayload> GetPayload(HarpMessage message)
+        {
+            return ThresholdLow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.
+    /// </summary>
+    [Description("Number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.")]
+    public partial class ThresholdSlopeSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdSlopeSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 114;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdSlopeSamples"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdSlopeSamples"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static ThresholdSlopeSamplesPayload ParsePayload(byte[] payload)
+        {
+            ThresholdSlopeSamplesPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static byte[] FormatPayload(ThresholdSlopeSamplesPayload value)
+        {
+            byte[] result;
+            result = new byte[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdSlopeSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdSlopeSamplesPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdSlopeSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdSlopeSamplesPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdSlopeSamples"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdSlopeSamples"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdSlopeSamplesPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdSlopeSamples"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdSlopeSamples"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdSlopeSamplesPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdSlopeSamples register.
+    /// </summary>
+    /// <seealso cref="ThresholdSlopeSamples"/>
+    [Description("Filters and selects timestamped messages from the ThresholdSlopeSamples register.")]
+    public partial class TimestampedThresholdSlopeSamples
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdSlopeSamples"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdSlopeSamples.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdSlopeSamples"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdSlopeSamplesPayload> GetPayload(HarpMessage message)
+        {
+            return ThresholdSlopeSamples.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.
+    /// </summary>
+    [Description("Specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.")]
+    public partial class ThresholdLogic
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdLogic"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 115;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdLogic"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdLogic"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static ThresholdLogicPayload ParsePayload(byte[] payload)
+        {
+            ThresholdLogicPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static byte[] FormatPayload(ThresholdLogicPayload value)
+        {
+            byte[] result;
+            result = new byte[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdLogic"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdLogicPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdLogic"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdLogicPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdLogic"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdLogic"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdLogicPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdLogic"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdLogic"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdLogicPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdLogic register.
+    /// </summary>
+    /// <seealso cref="ThresholdLogic"/>
+    [Description("Filters and selects timestamped messages from the ThresholdLogic register.")]
+    public partial class TimestampedThresholdLogic
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdLogic"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdLogic.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdLogic"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdLogicPayload> GetPayload(HarpMessage message)
+        {
+            return ThresholdLogic.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.
+    /// </summary>
+    [Description("Comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.")]
+    public partial class ThresholdLogicInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdLogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 116;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ThresholdLogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ThresholdLogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static ThresholdLogicInputsPayload ParsePayload(byte[] payload)
+        {
+            ThresholdLogicInputsPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static byte[] FormatPayload(ThresholdLogicInputsPayload value)
+        {
+            byte[] result;
+            result = new byte[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ThresholdLogicInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ThresholdLogicInputsPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ThresholdLogicInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdLogicInputsPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ThresholdLogicInputs"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdLogicInputs"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ThresholdLogicInputsPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ThresholdLogicInputs"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ThresholdLogicInputs"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ThresholdLogicInputsPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ThresholdLogicInputs register.
+    /// </summary>
+    /// <seealso cref="ThresholdLogicInputs"/>
+    [Description("Filters and selects timestamped messages from the ThresholdLogicInputs register.")]
+    public partial class TimestampedThresholdLogicInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ThresholdLogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ThresholdLogicInputs.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ThresholdLogicInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ThresholdLogicInputsPayload> GetPayload(HarpMessage message)
+        {
+            return ThresholdLogicInputs.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.
+    /// </summary>
+    [Description("Width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.")]
+    public partial class PulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 117;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static PulseWidthPayload ParsePayload(ushort[] payload)
+        {
+            PulseWidthPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static ushort[] FormatPayload(PulseWidthPayload value)
+        {
+            ushort[] result;
+            result = new ushort[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseWidthPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseWidthPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseWidth"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseWidth"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseWidthPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseWidth"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseWidth"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseWidthPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseWidth register.
+    /// </summary>
+    /// <seealso cref="PulseWidth"/>
+    [Description("Filters and selects timestamped messages from the PulseWidth register.")]
+    public partial class TimestampedPulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseWidth.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseWidthPayload> GetPayload(HarpMessage message)
+        {
+            return PulseWidth.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.
+    /// </summary>
+    [Description("Period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.")]
+    public partial class PulsePeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulsePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 118;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulsePeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulsePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static PulsePeriodPayload ParsePayload(ushort[] payload)
+        {
+            PulsePeriodPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static ushort[] FormatPayload(PulsePeriodPayload value)
+        {
+            ushort[] result;
+            result = new ushort[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulsePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulsePeriodPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulsePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulsePeriodPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulsePeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulsePeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulsePeriodPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulsePeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulsePeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulsePeriodPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulsePeriod register.
+    /// </summary>
+    /// <seealso cref="PulsePeriod"/>
+    [Description("Filters and selects timestamped messages from the PulsePeriod register.")]
+    public partial class TimestampedPulsePeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulsePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulsePeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulsePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulsePeriodPayload> GetPayload(HarpMessage message)
+        {
+            return PulsePeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.
+    /// </summary>
+    [Description("Number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.")]
+    public partial class PulseCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 119;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static PulseCountPayload ParsePayload(byte[] payload)
+        {
+            PulseCountPayload result;
+            result.Output1 = payload[0];
+            result.Output2 = payload[1];
+            result.Output3 = payload[2];
+            result.Output4 = payload[3];
+            result.Output5 = payload[4];
+            result.Output6 = payload[5];
+            result.Output7 = payload[6];
+            result.Output8 = payload[7];
+            return result;
+        }
+
+        static byte[] FormatPayload(PulseCountPayload value)
+        {
+            byte[] result;
+            result = new byte[8];
+            result[0] = value.Output1;
+            result[1] = value.Output2;
+            result[2] = value.Output3;
+            result[3] = value.Output4;
+            result[4] = value.Output5;
+            result[5] = value.Output6;
+            result[6] = value.Output7;
+            result[7] = value.Output8;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseCountPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseCountPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseCountPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseCountPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseCount register.
+    /// </summary>
+    /// <seealso cref="PulseCount"/>
+    [Description("Filters and selects timestamped messages from the PulseCount register.")]
+    public partial class TimestampedPulseCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseCountPayload> GetPayload(HarpMessage message)
+        {
+            return PulseCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.
+    /// </summary>
+    [Description("Up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.")]
+    public partial class DoSchedule
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoSchedule"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 120;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DoSchedule"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DoSchedule"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 60;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DoSchedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DoSchedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DoSchedule"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoSchedule"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DoSchedule"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoSchedule"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DoSchedule register.
+    /// </summary>
+    /// <seealso cref="DoSchedule"/>
+    [Description("Filters and selects timestamped messages from the DoSchedule register.")]
+    public partial class TimestampedDoSchedule
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoSchedule"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DoSchedule.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DoSchedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return DoSchedule.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of entries of DoSchedule that are played, from 0 to 30.
+    /// </summary>
+    [Description("Number of entries of DoSchedule that are played, from 0 to 30.")]
+    public partial class DoScheduleLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoScheduleLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 121;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DoScheduleLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DoScheduleLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DoScheduleLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DoScheduleLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DoScheduleLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoScheduleLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DoScheduleLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoScheduleLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DoScheduleLength register.
+    /// </summary>
+    /// <seealso cref="DoScheduleLength"/>
+    [Description("Filters and selects timestamped messages from the DoScheduleLength register.")]
+    public partial class TimestampedDoScheduleLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoScheduleLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DoScheduleLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DoScheduleLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DoScheduleLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.
+    /// </summary>
+    [Description("Harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.")]
+    public partial class DoScheduleStartTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoScheduleStartTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 122;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DoScheduleStartTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DoScheduleStartTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static DoScheduleStartTimePayload ParsePayload(uint[] payload)
+        {
+            DoScheduleStartTimePayload result;
+            result.Seconds = payload[0];
+            result.Microseconds = payload[1];
+            return result;
+        }
+
+        static uint[] FormatPayload(DoScheduleStartTimePayload value)
+        {
+            uint[] result;
+            result = new uint[2];
+            result[0] = value.Seconds;
+            result[1] = value.Microseconds;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DoScheduleStartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DoScheduleStartTimePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DoScheduleStartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DoScheduleStartTimePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DoScheduleStartTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoScheduleStartTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DoScheduleStartTimePayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DoScheduleStartTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoScheduleStartTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DoScheduleStartTimePayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DoScheduleStartTime register.
+    /// </summary>
+    /// <seealso cref="DoScheduleStartTime"/>
+    [Description("Filters and selects timestamped messages from the DoScheduleStartTime register.")]
+    public partial class TimestampedDoScheduleStartTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoScheduleStartTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DoScheduleStartTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DoScheduleStartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DoScheduleStartTimePayload> GetPayload(HarpMessage message)
+        {
+            return DoScheduleStartTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.
+    /// </summary>
+    [Description("Starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.")]
+    public partial class DoScheduleStart
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoScheduleStart"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 123;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DoScheduleStart"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DoScheduleStart"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DoScheduleStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ScheduleStartConfig GetPayload(HarpMessage message)
+        {
+            return (ScheduleStartConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DoScheduleStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ScheduleStartConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ScheduleStartConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DoScheduleStart"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoScheduleStart"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ScheduleStartConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DoScheduleStart"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DoScheduleStart"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ScheduleStartConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DoScheduleStart register.
+    /// </summary>
+    /// <seealso cref="DoScheduleStart"/>
+    [Description("Filters and selects timestamped messages from the DoScheduleStart register.")]
+    public partial class TimestampedDoScheduleStart
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DoScheduleStart"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DoScheduleStart.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DoScheduleStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ScheduleStartConfig> GetPayload(HarpMessage message)
+        {
+            return DoScheduleStart.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.
+    /// </summary>
+    [Description("Edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.")]
+    public partial class DigitalInputEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 124;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputEdge"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputEdge"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static DigitalInputEdgePayload ParsePayload(ushort[] payload)
+        {
+            DigitalInputEdgePayload result;
+            result.State = payload[0];
+            result.Capture = payload[1];
+            return result;
+        }
+
+        static ushort[] FormatPayload(DigitalInputEdgePayload value)
+        {
+            ushort[] result;
+            result = new ushort[2];
+            result[0] = value.State;
+            result[1] = value.Capture;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputEdgePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputEdgePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputEdge"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputEdge"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputEdgePayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputEdge"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputEdge"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputEdgePayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputEdge register.
+    /// </summary>
+    /// <seealso cref="DigitalInputEdge"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputEdge register.")]
+    public partial class TimestampedDigitalInputEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputEdge.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputEdgePayload> GetPayload(HarpMessage message)
+        {
+            return DigitalInputEdge.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// LoadCells device.
     /// </summary>
-    /// <seealso cref="CreateAcquisitionStatePayload"/>
-    /// <seealso cref="CreateLoadCellDataPayload"/>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateSyncOutputStatePayload"/>
-    /// <seealso cref="CreateDI0TriggerPayload"/>
-    /// <seealso cref="CreateDO0SyncPayload"/>
-    /// <seealso cref="CreateDO0PulseWidthPayload"/>
-    /// <seealso cref="CreateDigitalOutputSetPayload"/>
-    /// <seealso cref="CreateDigitalOutputClearPayload"/>
-    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
-    /// <seealso cref="CreateDigitalOutputStatePayload"/>
-    /// <seealso cref="CreateOffsetLoadCell0Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell1Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell2Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell3Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell4Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell5Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell6Payload"/>
-    /// <seealso cref="CreateOffsetLoadCell7Payload"/>
-    /// <seealso cref="CreateDO1TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO2TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO3TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO4TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO5TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO6TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO7TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO8TargetLoadCellPayload"/>
-    /// <seealso cref="CreateDO1ThresholdPayload"/>
-    /// <seealso cref="CreateDO2ThresholdPayload"/>
-    /// <seealso cref="CreateDO3ThresholdPayload"/>
-    /// <seealso cref="CreateDO4ThresholdPayload"/>
-    /// <seealso cref="CreateDO5ThresholdPayload"/>
-    /// <seealso cref="CreateDO6ThresholdPayload"/>
-    /// <seealso cref="CreateDO7ThresholdPayload"/>
-    /// <seealso cref="CreateDO8ThresholdPayload"/>
-    /// <seealso cref="CreateDO1TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO2TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO3TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO4TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO5TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO6TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO7TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO8TimeAboveThresholdPayload"/>
-    /// <seealso cref="CreateDO1TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO2TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO3TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO4TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO5TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO6TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO7TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateDO8TimeBelowThresholdPayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    [XmlInclude(typeof(CreateAcquisitionStatePayload))]
-    [XmlInclude(typeof(CreateLoadCellDataPayload))]
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateSyncOutputStatePayload))]
-    [XmlInclude(typeof(CreateDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateDO0SyncPayload))]
-    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell0Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell1Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell2Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell3Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell4Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell5Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell6Payload))]
-    [XmlInclude(typeof(CreateOffsetLoadCell7Payload))]
-    [XmlInclude(typeof(CreateDO1TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO2TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO3TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO4TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO5TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO6TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO7TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO8TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateDO1ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO2ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO3ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO4ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO5ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO6ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO7ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO8ThresholdPayload))]
-    [XmlInclude(typeof(CreateDO1TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO2TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO3TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO4TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO5TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO6TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO7TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO8TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateDO1TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO2TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO3TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO4TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO5TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO6TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO7TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateDO8TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedAcquisitionStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedLoadCellDataPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedSyncOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell0Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell1Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell2Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell3Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell4Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell5Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell6Payload))]
-    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell7Payload))]
-    [XmlInclude(typeof(CreateTimestampedDO1TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO4TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO5TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO6TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO7TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO8TargetLoadCellPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO4ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO5ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO6ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO7ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO8ThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO4TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO5TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO6TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO7TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO8TimeAboveThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO2TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO3TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO4TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO5TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO6TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO7TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO8TimeBelowThresholdPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [Description("Creates standard message payloads for the LoadCells device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateAcquisitionStatePayload"/>
+    /// <seealso cref="CreateLoadCellDataPayload"/>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateSyncOutputStatePayload"/>
+    /// <seealso cref="CreateDI0TriggerPayload"/>
+    /// <seealso cref="CreateDO0SyncPayload"/>
+    /// <seealso cref="CreateDO0PulseWidthPayload"/>
+    /// <seealso cref="CreateDigitalOutputSetPayload"/>
+    /// <seealso cref="CreateDigitalOutputClearPayload"/>
+    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
+    /// <seealso cref="CreateDigitalOutputStatePayload"/>
+    /// <seealso cref="CreateOffsetLoadCell0Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell1Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell2Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell3Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell4Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell5Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell6Payload"/>
+    /// <seealso cref="CreateOffsetLoadCell7Payload"/>
+    /// <seealso cref="CreateDO1TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO2TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO3TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO4TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO5TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO6TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO7TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO8TargetLoadCellPayload"/>
+    /// <seealso cref="CreateDO1ThresholdPayload"/>
+    /// <seealso cref="CreateDO2ThresholdPayload"/>
+    /// <seealso cref="CreateDO3ThresholdPayload"/>
+    /// <seealso cref="CreateDO4ThresholdPayload"/>
+    /// <seealso cref="CreateDO5ThresholdPayload"/>
+    /// <seealso cref="CreateDO6ThresholdPayload"/>
+    /// <seealso cref="CreateDO7ThresholdPayload"/>
+    /// <seealso cref="CreateDO8ThresholdPayload"/>
+    /// <seealso cref="CreateDO1TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO2TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO3TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO4TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO5TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO6TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO7TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO8TimeAboveThresholdPayload"/>
+    /// <seealso cref="CreateDO1TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO2TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO3TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO4TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO5TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO6TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO7TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateDO8TimeBelowThresholdPayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateSampleRatePayload"/>
+    /// <seealso cref="CreateDecimationPayload"/>
+    /// <seealso cref="CreateLoadCellDataBatchPayload"/>
+    /// <seealso cref="CreateBatchSizePayload"/>
+    /// <seealso cref="CreateEnablePortsPayload"/>
+    /// <seealso cref="CreateThresholdsModePayload"/>
+    /// <seealso cref="CreateThresholdsLatencyPayload"/>
+    /// <seealso cref="CreateAutoZeroPayload"/>
+    /// <seealso cref="CreatePerformanceCountersPayload"/>
+    /// <seealso cref="CreateEnableSequencePayload"/>
+    /// <seealso cref="CreateDeltaKeyframeIntervalPayload"/>
+    /// <seealso cref="CreateLoadCellDataDeltaPayload"/>
+    /// <seealso cref="CreateDeadbandPayload"/>
+    /// <seealso cref="CreateDeadbandHeartbeatPayload"/>
+    /// <seealso cref="CreateFilterModePayload"/>
+    /// <seealso cref="CreateFilterLengthPayload"/>
+    /// <seealso cref="CreateFilterChannelsPayload"/>
+    /// <seealso cref="CreateFilterTargetsPayload"/>
+    /// <seealso cref="CreateVirtualChannelWeightsPayload"/>
+    /// <seealso cref="CreateVirtualChannelShiftPayload"/>
+    /// <seealso cref="CreateLoadCellDataVirtualPayload"/>
+    /// <seealso cref="CreateThresholdComparatorPayload"/>
+    /// <seealso cref="CreateThresholdLowPayload"/>
+    /// <seealso cref="CreateThresholdSlopeSamplesPayload"/>
+    /// <seealso cref="CreateThresholdLogicPayload"/>
+    /// <seealso cref="CreateThresholdLogicInputsPayload"/>
+    /// <seealso cref="CreatePulseWidthPayload"/>
+    /// <seealso cref="CreatePulsePeriodPayload"/>
+    /// <seealso cref="CreatePulseCountPayload"/>
+    /// <seealso cref="CreateDoSchedulePayload"/>
+    /// <seealso cref="CreateDoScheduleLengthPayload"/>
+    /// <seealso cref="CreateDoScheduleStartTimePayload"/>
+    /// <seealso cref="CreateDoScheduleStartPayload"/>
+    /// <seealso cref="CreateDigitalInputEdgePayload"/>
+    [XmlInclude(typeof(CreateAcquisitionStatePayload))]
+    [XmlInclude(typeof(CreateLoadCellDataPayload))]
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateSyncOutputStatePayload))]
+    [XmlInclude(typeof(CreateDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateDO0SyncPayload))]
+    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell0Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell1Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell2Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell3Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell4Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell5Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell6Payload))]
+    [XmlInclude(typeof(CreateOffsetLoadCell7Payload))]
+    [XmlInclude(typeof(CreateDO1TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO2TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO3TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO4TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO5TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO6TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO7TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO8TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateDO1ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO2ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO3ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO4ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO5ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO6ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO7ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO8ThresholdPayload))]
+    [XmlInclude(typeof(CreateDO1TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO2TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO3TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO4TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO5TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO6TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO7TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO8TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateDO1TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO2TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO3TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO4TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO5TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO6TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO7TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateDO8TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateSampleRatePayload))]
+    [XmlInclude(typeof(CreateDecimationPayload))]
+    [XmlInclude(typeof(CreateLoadCellDataBatchPayload))]
+    [XmlInclude(typeof(CreateBatchSizePayload))]
+    [XmlInclude(typeof(CreateEnablePortsPayload))]
+    [XmlInclude(typeof(CreateThresholdsModePayload))]
+    [XmlInclude(typeof(CreateThresholdsLatencyPayload))]
+    [XmlInclude(typeof(CreateAutoZeroPayload))]
+    [XmlInclude(typeof(CreatePerformanceCountersPayload))]
+    [XmlInclude(typeof(CreateEnableSequencePayload))]
+    [XmlInclude(typeof(CreateDeltaKeyframeIntervalPayload))]
+    [XmlInclude(typeof(CreateLoadCellDataDeltaPayload))]
+    [XmlInclude(typeof(CreateDeadbandPayload))]
+    [XmlInclude(typeof(CreateDeadbandHeartbeatPayload))]
+    [XmlInclude(typeof(CreateFilterModePayload))]
+    [XmlInclude(typeof(CreateFilterLengthPayload))]
+    [XmlInclude(typeof(CreateFilterChannelsPayload))]
+    [XmlInclude(typeof(CreateFilterTargetsPayload))]
+    [XmlInclude(typeof(CreateVirtualChannelWeightsPayload))]
+    [XmlInclude(typeof(CreateVirtualChannelShiftPayload))]
+    [XmlInclude(typeof(CreateLoadCellDataVirtualPayload))]
+    [XmlInclude(typeof(CreateThresholdComparatorPayload))]
+    [XmlInclude(typeof(CreateThresholdLowPayload))]
+    [XmlInclude(typeof(CreateThresholdSlopeSamplesPayload))]
+    [XmlInclude(typeof(CreateThresholdLogicPayload))]
+    [XmlInclude(typeof(CreateThresholdLogicInputsPayload))]
+    [XmlInclude(typeof(CreatePulseWidthPayload))]
+    [XmlInclude(typeof(CreatePulsePeriodPayload))]
+    [XmlInclude(typeof(CreatePulseCountPayload))]
+    [XmlInclude(typeof(CreateDoSchedulePayload))]
+    [XmlInclude(typeof(CreateDoScheduleLengthPayload))]
+    [XmlInclude(typeof(CreateDoScheduleStartTimePayload))]
+    [XmlInclude(typeof(CreateDoScheduleStartPayload))]
+    [XmlInclude(typeof(CreateDigitalInputEdgePayload))]
+    [XmlInclude(typeof(CreateTimestampedAcquisitionStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedLoadCellDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSyncOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell0Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell1Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell2Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell3Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell4Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell5Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell6Payload))]
+    [XmlInclude(typeof(CreateTimestampedOffsetLoadCell7Payload))]
+    [XmlInclude(typeof(CreateTimestampedDO1TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO4TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO5TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO6TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO7TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO8TargetLoadCellPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO4ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO5ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO6ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO7ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO8ThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO4TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO5TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO6TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO7TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO8TimeAboveThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO2TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO3TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO4TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO5TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO6TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO7TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO8TimeBelowThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSampleRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDecimationPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoadCellDataBatchPayload))]
+    [XmlInclude(typeof(CreateTimestampedBatchSizePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnablePortsPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdsModePayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdsLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedAutoZeroPayload))]
+    [XmlInclude(typeof(CreateTimestampedPerformanceCountersPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableSequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedDeltaKeyframeIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoadCellDataDeltaPayload))]
+    [XmlInclude(typeof(CreateTimestampedDeadbandPayload))]
+    [XmlInclude(typeof(CreateTimestampedDeadbandHeartbeatPayload))]
+    [XmlInclude(typeof(CreateTimestampedFilterModePayload))]
+    [XmlInclude(typeof(CreateTimestampedFilterLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedFilterChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedFilterTargetsPayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualChannelWeightsPayload))]
+    [XmlInclude(typeof(CreateTimestampedVirtualChannelShiftPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoadCellDataVirtualPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdComparatorPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdLowPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdSlopeSamplesPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdLogicPayload))]
+    [XmlInclude(typeof(CreateTimestampedThresholdLogicInputsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulsePeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedDoSchedulePayload))]
+    [XmlInclude(typeof(CreateTimestampedDoScheduleLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDoScheduleStartTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedDoScheduleStartPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputEdgePayload))]
+    [Description("Creates standard message payloads for the LoadCells device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateAcquisitionStatePayload();
+        }
+
+        string INamedElement.Name => $"{nameof(LoadCells)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the data acquisition.
+    /// </summary>
+    [DisplayName("AcquisitionStatePayload")]
+    [Description("Creates a message payload that enables the data acquisition.")]
+    public partial class CreateAcquisitionStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the data acquisition.
+        /// </summary>
+        [Description("The value that enables the data acquisition.")]
+        public EnableFlag AcquisitionState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AcquisitionState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return AcquisitionState;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the data acquisition.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AcquisitionState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.AcquisitionState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the data acquisition.
+    /// </summary>
+    [DisplayName("TimestampedAcquisitionStatePayload")]
+    [Description("Creates a timestamped message payload that enables the data acquisition.")]
+    public partial class CreateTimestampedAcquisitionStatePayload : CreateAcquisitionStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the data acquisition.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AcquisitionState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.AcquisitionState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.
+    /// </summary>
+    [DisplayName("LoadCellDataPayload")]
+    [Description("Creates a message payload that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.")]
+    public partial class CreateLoadCellDataPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel0.
+        /// </summary>
+        [Description("")]
+        public short Channel0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel1.
+        /// </summary>
+        [Description("")]
+        public short Channel1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel2.
+        /// </summary>
+        [Description("")]
+        public short Channel2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel3.
+        /// </summary>
+        [Description("")]
+        public short Channel3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel4.
+        /// </summary>
+        [Description("")]
+        public short Channel4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel5.
+        /// </summary>
+        [Description("")]
+        public short Channel5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel6.
+        /// </summary>
+        [Description("")]
+        public short Channel6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel7.
+        /// </summary>
+        [Description("")]
+        public short Channel7 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LoadCellData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellDataPayload GetPayload()
+        {
+            LoadCellDataPayload value;
+            value.Channel0 = Channel0;
+            value.Channel1 = Channel1;
+            value.Channel2 = Channel2;
+            value.Channel3 = Channel3;
+            value.Channel4 = Channel4;
+            value.Channel5 = Channel5;
+            value.Channel6 = Channel6;
+            value.Channel7 = Channel7;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LoadCellData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.LoadCellData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.
+    /// </summary>
+    [DisplayName("TimestampedLoadCellDataPayload")]
+    [Description("Creates a timestamped message payload that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.")]
+    public partial class CreateTimestampedLoadCellDataPayload : CreateLoadCellDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value of single ADC read from all load cell channels. If only one port is enabled, the payload has the four channels of that port.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LoadCellData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.LoadCellData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+        /// </summary>
+        [Description("The value that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+    /// </summary>
+    [DisplayName("SyncOutputStatePayload")]
+    [Description("Creates a message payload that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.")]
+    public partial class CreateSyncOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+        /// </summary>
+        [Description("The value that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.")]
+        public SyncOutputs SyncOutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SyncOutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SyncOutputs GetPayload()
+        {
+            return SyncOutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SyncOutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.SyncOutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+    /// </summary>
+    [DisplayName("TimestampedSyncOutputStatePayload")]
+    [Description("Creates a timestamped message payload that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.")]
+    public partial class CreateTimestampedSyncOutputStatePayload : CreateSyncOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SyncOutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.SyncOutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital input pin 0.
+    /// </summary>
+    [DisplayName("DI0TriggerPayload")]
+    [Description("Creates a message payload that configuration of the digital input pin 0.")]
+    public partial class CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital input pin 0.
+        /// </summary>
+        [Description("The value that configuration of the digital input pin 0.")]
+        public TriggerConfig DI0Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TriggerConfig GetPayload()
+        {
+            return DI0Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital input pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DI0Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital input pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDI0TriggerPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital input pin 0.")]
+    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital input pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital output pin 0.
+    /// </summary>
+    [DisplayName("DO0SyncPayload")]
+    [Description("Creates a message payload that configuration of the digital output pin 0.")]
+    public partial class CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital output pin 0.
+        /// </summary>
+        [Description("The value that configuration of the digital output pin 0.")]
+        public SyncConfig DO0Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SyncConfig GetPayload()
+        {
+            return DO0Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital output pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO0Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital output pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDO0SyncPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital output pin 0.")]
+    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital output pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// </summary>
+    [DisplayName("DO0PulseWidthPayload")]
+    [Description("Creates a message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
+    public partial class CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// </summary>
+        [Range(min: 1, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
+        public byte DO0PulseWidth { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the DO0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return DO0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// </summary>
+    [DisplayName("TimestampedDO0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
+    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputClearPayload")]
+    [Description("Creates a message payload that clear the specified digital output lines.")]
+    public partial class CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clear the specified digital output lines.
+        /// </summary>
+        [Description("The value that clear the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputTogglePayload")]
+    [Description("Creates a message payload that toggle the specified digital output lines.")]
+    public partial class CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggle the specified digital output lines.
+        /// </summary>
+        [Description("The value that toggle the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggle the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputTogglePayload")]
+    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// </summary>
+    [DisplayName("DigitalOutputStatePayload")]
+    [Description("Creates a message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
+    public partial class CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// </summary>
+        [Description("The value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
+        public DigitalOutputs DigitalOutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
+    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 0.
+    /// </summary>
+    [DisplayName("OffsetLoadCell0Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 0.")]
+    public partial class CreateOffsetLoadCell0Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 0.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 0.")]
+        public short OffsetLoadCell0 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell0 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell0;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell0 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell0.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 0.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell0Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 0.")]
+    public partial class CreateTimestampedOffsetLoadCell0Payload : CreateOffsetLoadCell0Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell0 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell0.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 1.
+    /// </summary>
+    [DisplayName("OffsetLoadCell1Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 1.")]
+    public partial class CreateOffsetLoadCell1Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 1.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 1.")]
+        public short OffsetLoadCell1 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell1 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell1;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell1 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell1.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 1.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell1Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 1.")]
+    public partial class CreateTimestampedOffsetLoadCell1Payload : CreateOffsetLoadCell1Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell1 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell1.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 2.
+    /// </summary>
+    [DisplayName("OffsetLoadCell2Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 2.")]
+    public partial class CreateOffsetLoadCell2Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 2.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 2.")]
+        public short OffsetLoadCell2 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell2 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell2;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell2 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell2.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 2.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell2Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 2.")]
+    public partial class CreateTimestampedOffsetLoadCell2Payload : CreateOffsetLoadCell2Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell2 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell2.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 3.
+    /// </summary>
+    [DisplayName("OffsetLoadCell3Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 3.")]
+    public partial class CreateOffsetLoadCell3Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 3.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 3.")]
+        public short OffsetLoadCell3 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell3 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell3;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell3 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell3.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 3.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell3Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 3.")]
+    public partial class CreateTimestampedOffsetLoadCell3Payload : CreateOffsetLoadCell3Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell3 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell3.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 4.
+    /// </summary>
+    [DisplayName("OffsetLoadCell4Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 4.")]
+    public partial class CreateOffsetLoadCell4Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 4.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 4.")]
+        public short OffsetLoadCell4 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell4 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell4;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 4.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell4 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell4.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 4.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell4Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 4.")]
+    public partial class CreateTimestampedOffsetLoadCell4Payload : CreateOffsetLoadCell4Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 4.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell4 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell4.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 5.
+    /// </summary>
+    [DisplayName("OffsetLoadCell5Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 5.")]
+    public partial class CreateOffsetLoadCell5Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 5.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 5.")]
+        public short OffsetLoadCell5 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell5 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell5;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 5.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell5 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell5.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 5.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell5Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 5.")]
+    public partial class CreateTimestampedOffsetLoadCell5Payload : CreateOffsetLoadCell5Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 5.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell5 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell5.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 6.
+    /// </summary>
+    [DisplayName("OffsetLoadCell6Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 6.")]
+    public partial class CreateOffsetLoadCell6Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 6.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 6.")]
+        public short OffsetLoadCell6 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell6 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell6;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 6.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell6 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell6.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 6.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell6Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 6.")]
+    public partial class CreateTimestampedOffsetLoadCell6Payload : CreateOffsetLoadCell6Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 6.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell6 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell6.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that offset value for Load Cell channel 7.
+    /// </summary>
+    [DisplayName("OffsetLoadCell7Payload")]
+    [Description("Creates a message payload that offset value for Load Cell channel 7.")]
+    public partial class CreateOffsetLoadCell7Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that offset value for Load Cell channel 7.
+        /// </summary>
+        [Range(min: -255, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that offset value for Load Cell channel 7.")]
+        public short OffsetLoadCell7 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the OffsetLoadCell7 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return OffsetLoadCell7;
+        }
+
+        /// <summary>
+        /// Creates a message that offset value for Load Cell channel 7.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OffsetLoadCell7 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell7.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that offset value for Load Cell channel 7.
+    /// </summary>
+    [DisplayName("TimestampedOffsetLoadCell7Payload")]
+    [Description("Creates a timestamped message payload that offset value for Load Cell channel 7.")]
+    public partial class CreateTimestampedOffsetLoadCell7Payload : CreateOffsetLoadCell7Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that offset value for Load Cell channel 7.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OffsetLoadCell7 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.OffsetLoadCell7.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+    /// </summary>
+    [DisplayName("DO1TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO1 pin.")]
+    public partial class CreateDO1TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO1 pin.")]
+        public LoadCellChannel DO1TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO1TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO1TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO1TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO1 pin.")]
+    public partial class CreateTimestampedDO1TargetLoadCellPayload : CreateDO1TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO1TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+    /// </summary>
+    [DisplayName("DO2TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO2 pin.")]
+    public partial class CreateDO2TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO2 pin.")]
+        public LoadCellChannel DO2TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO2TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO2TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO2TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO2TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO2TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO2 pin.")]
+    public partial class CreateTimestampedDO2TargetLoadCellPayload : CreateDO2TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO2TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO2TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+    /// </summary>
+    [DisplayName("DO3TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO3 pin.")]
+    public partial class CreateDO3TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO3 pin.")]
+        public LoadCellChannel DO3TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO3TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO3TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO3TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO3TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO3TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO3 pin.")]
+    public partial class CreateTimestampedDO3TargetLoadCellPayload : CreateDO3TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO3TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO3TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+    /// </summary>
+    [DisplayName("DO4TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO4 pin.")]
+    public partial class CreateDO4TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO4 pin.")]
+        public LoadCellChannel DO4TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO4TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO4TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO4TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO4TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO4TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO4 pin.")]
+    public partial class CreateTimestampedDO4TargetLoadCellPayload : CreateDO4TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO4TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO4TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+    /// </summary>
+    [DisplayName("DO5TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO5 pin.")]
+    public partial class CreateDO5TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO5 pin.")]
+        public LoadCellChannel DO5TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO5TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO5TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO5TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO5TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO5TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO5 pin.")]
+    public partial class CreateTimestampedDO5TargetLoadCellPayload : CreateDO5TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO5TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO5TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+    /// </summary>
+    [DisplayName("DO6TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO6 pin.")]
+    public partial class CreateDO6TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO6 pin.")]
+        public LoadCellChannel DO6TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO6TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO6TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO6TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO6TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO6TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO6 pin.")]
+    public partial class CreateTimestampedDO6TargetLoadCellPayload : CreateDO6TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO6TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO6TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+    /// </summary>
+    [DisplayName("DO7TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO7 pin.")]
+    public partial class CreateDO7TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO7 pin.")]
+        public LoadCellChannel DO7TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO7TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO7TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO7TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO7TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO7TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO7 pin.")]
+    public partial class CreateTimestampedDO7TargetLoadCellPayload : CreateDO7TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO7TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO7TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+    /// </summary>
+    [DisplayName("DO8TargetLoadCellPayload")]
+    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO8 pin.")]
+    public partial class CreateDO8TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+        /// </summary>
+        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO8 pin.")]
+        public LoadCellChannel DO8TargetLoadCell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO8TargetLoadCell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public LoadCellChannel GetPayload()
+        {
+            return DO8TargetLoadCell;
+        }
+
+        /// <summary>
+        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO8TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO8TargetLoadCell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO8TargetLoadCellPayload")]
+    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO8 pin.")]
+    public partial class CreateTimestampedDO8TargetLoadCellPayload : CreateDO8TargetLoadCellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO8TargetLoadCell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO8TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO1 pin.
+    /// </summary>
+    [DisplayName("DO1ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO1 pin.")]
+    public partial class CreateDO1ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO1 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO1 pin.")]
+        public short DO1Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO1Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO1 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO1Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO1 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO1ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO1 pin.")]
+    public partial class CreateTimestampedDO1ThresholdPayload : CreateDO1ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO1 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO1Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO2 pin.
+    /// </summary>
+    [DisplayName("DO2ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO2 pin.")]
+    public partial class CreateDO2ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO2 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO2 pin.")]
+        public short DO2Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO2Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO2Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO2 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO2Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO2Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO2 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO2ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO2 pin.")]
+    public partial class CreateTimestampedDO2ThresholdPayload : CreateDO2ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO2 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO2Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO2Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO3 pin.
+    /// </summary>
+    [DisplayName("DO3ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO3 pin.")]
+    public partial class CreateDO3ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO3 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO3 pin.")]
+        public short DO3Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO3Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO3Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO3 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO3Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO3Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO3 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO3ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO3 pin.")]
+    public partial class CreateTimestampedDO3ThresholdPayload : CreateDO3ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO3 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO3Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO3Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO4 pin.
+    /// </summary>
+    [DisplayName("DO4ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO4 pin.")]
+    public partial class CreateDO4ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO4 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO4 pin.")]
+        public short DO4Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO4Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO4Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO4 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO4Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO4Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO4 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO4ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO4 pin.")]
+    public partial class CreateTimestampedDO4ThresholdPayload : CreateDO4ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO4 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO4Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO4Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO5 pin.
+    /// </summary>
+    [DisplayName("DO5ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO5 pin.")]
+    public partial class CreateDO5ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO5 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO5 pin.")]
+        public short DO5Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO5Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO5Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO5 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO5Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO5Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO5 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO5ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO5 pin.")]
+    public partial class CreateTimestampedDO5ThresholdPayload : CreateDO5ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO5 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO5Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO5Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO6 pin.
+    /// </summary>
+    [DisplayName("DO6ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO6 pin.")]
+    public partial class CreateDO6ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO6 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO6 pin.")]
+        public short DO6Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO6Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO6Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO6 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO6Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO6Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO6 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO6ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO6 pin.")]
+    public partial class CreateTimestampedDO6ThresholdPayload : CreateDO6ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO6 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO6Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO6Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO7 pin.
+    /// </summary>
+    [DisplayName("DO7ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO7 pin.")]
+    public partial class CreateDO7ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO7 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO7 pin.")]
+        public short DO7Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO7Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO7Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO7 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO7Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO7Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO7 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO7ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO7 pin.")]
+    public partial class CreateTimestampedDO7ThresholdPayload : CreateDO7ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO7 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO7Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO7Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value used to threshold a Load Cell read, and trigger DO8 pin.
+    /// </summary>
+    [DisplayName("DO8ThresholdPayload")]
+    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO8 pin.")]
+    public partial class CreateDO8ThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO8 pin.
+        /// </summary>
+        [Description("The value that value used to threshold a Load Cell read, and trigger DO8 pin.")]
+        public short DO8Threshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO8Threshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public short GetPayload()
+        {
+            return DO8Threshold;
+        }
+
+        /// <summary>
+        /// Creates a message that value used to threshold a Load Cell read, and trigger DO8 pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO8Threshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO8Threshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value used to threshold a Load Cell read, and trigger DO8 pin.
+    /// </summary>
+    [DisplayName("TimestampedDO8ThresholdPayload")]
+    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO8 pin.")]
+    public partial class CreateTimestampedDO8ThresholdPayload : CreateDO8ThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO8 pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO8Threshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO8Threshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// </summary>
+    [DisplayName("DO1TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateDO1TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+        public ushort DO1TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO1TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO1TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO1TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO1TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateTimestampedDO1TimeAboveThresholdPayload : CreateDO1TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO1TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// </summary>
+    [DisplayName("DO2TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateDO2TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+        public ushort DO2TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO2TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO2TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO2TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO2TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO2TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateTimestampedDO2TimeAboveThresholdPayload : CreateDO2TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO2TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO2TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// </summary>
+    [DisplayName("DO3TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateDO3TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+        public ushort DO3TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO3TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO3TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO3TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO3TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO3TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateTimestampedDO3TimeAboveThresholdPayload : CreateDO3TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO3TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO3TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO4 pin event.
+    /// </summary>
+    [DisplayName("DO4TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO4 pin event.")]
+    public partial class CreateDO4TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO4 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO4 pin event.")]
+        public ushort DO4TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO4TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO4TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO4 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO4TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO4TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO4 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO4TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO4 pin event.")]
+    public partial class CreateTimestampedDO4TimeAboveThresholdPayload : CreateDO4TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO4 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO4TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO4TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO5 pin event.
+    /// </summary>
+    [DisplayName("DO5TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO5 pin event.")]
+    public partial class CreateDO5TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO5 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO5 pin event.")]
+        public ushort DO5TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO5TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO5TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO5 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO5TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO5TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO5 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO5TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO5 pin event.")]
+    public partial class CreateTimestampedDO5TimeAboveThresholdPayload : CreateDO5TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO5 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO5TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO5TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO6 pin event.
+    /// </summary>
+    [DisplayName("DO6TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO6 pin event.")]
+    public partial class CreateDO6TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO6 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO6 pin event.")]
+        public ushort DO6TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO6TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO6TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO6 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO6TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO6TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO6 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO6TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO6 pin event.")]
+    public partial class CreateTimestampedDO6TimeAboveThresholdPayload : CreateDO6TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO6 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO6TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO6TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO7 pin event.
+    /// </summary>
+    [DisplayName("DO7TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO7 pin event.")]
+    public partial class CreateDO7TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO7 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO7 pin event.")]
+        public ushort DO7TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO7TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO7TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO7 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO7TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO7TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO7 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO7TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO7 pin event.")]
+    public partial class CreateTimestampedDO7TimeAboveThresholdPayload : CreateDO7TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO7 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO7TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO7TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) above threshold value that is required to trigger a DO8 pin event.
+    /// </summary>
+    [DisplayName("DO8TimeAboveThresholdPayload")]
+    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO8 pin event.")]
+    public partial class CreateDO8TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO8 pin event.
+        /// </summary>
+        [Description("The value that time (ms) above threshold value that is required to trigger a DO8 pin event.")]
+        public ushort DO8TimeAboveThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO8TimeAboveThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO8TimeAboveThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) above threshold value that is required to trigger a DO8 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO8TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO8TimeAboveThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) above threshold value that is required to trigger a DO8 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO8TimeAboveThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO8 pin event.")]
+    public partial class CreateTimestampedDO8TimeAboveThresholdPayload : CreateDO8TimeAboveThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO8 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO8TimeAboveThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO8TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
+    /// </summary>
+    [DisplayName("DO1TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateDO1TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+        public ushort DO1TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO1TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO1TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO1TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO1TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
+    public partial class CreateTimestampedDO1TimeBelowThresholdPayload : CreateDO1TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO1TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
+    /// </summary>
+    [DisplayName("DO2TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateDO2TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+        public ushort DO2TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO2TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO2TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO2TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO2TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO2TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
+    public partial class CreateTimestampedDO2TimeBelowThresholdPayload : CreateDO2TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO2TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO2TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// </summary>
+    [DisplayName("DO3TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateDO3TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+        public ushort DO3TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO3TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO3TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO3TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO3TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO3TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
+    public partial class CreateTimestampedDO3TimeBelowThresholdPayload : CreateDO3TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO3TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO3TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO4 pin event.
+    /// </summary>
+    [DisplayName("DO4TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO4 pin event.")]
+    public partial class CreateDO4TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO4 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO4 pin event.")]
+        public ushort DO4TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO4TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO4TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO4 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO4TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO4TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO4 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO4TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO4 pin event.")]
+    public partial class CreateTimestampedDO4TimeBelowThresholdPayload : CreateDO4TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO4 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO4TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO4TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO5 pin event.
+    /// </summary>
+    [DisplayName("DO5TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO5 pin event.")]
+    public partial class CreateDO5TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO5 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO5 pin event.")]
+        public ushort DO5TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO5TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO5TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO5 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO5TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO5TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO5 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO5TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO5 pin event.")]
+    public partial class CreateTimestampedDO5TimeBelowThresholdPayload : CreateDO5TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO5 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO5TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO5TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO6 pin event.
+    /// </summary>
+    [DisplayName("DO6TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO6 pin event.")]
+    public partial class CreateDO6TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO6 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO6 pin event.")]
+        public ushort DO6TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO6TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO6TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO6 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO6TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO6TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO6 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO6TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO6 pin event.")]
+    public partial class CreateTimestampedDO6TimeBelowThresholdPayload : CreateDO6TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO6 pin event.
         /// </summary>
-        public CreateMessage()
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO6TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            Payload = new CreateAcquisitionStatePayload();
+            return Harp.LoadCells.DO6TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
+    }
 
-        string INamedElement.Name => $"{nameof(LoadCells)}.{GetElementDisplayName(Payload)}";
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time (ms) below threshold value that is required to trigger a DO7 pin event.
+    /// </summary>
+    [DisplayName("DO7TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO7 pin event.")]
+    public partial class CreateDO7TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO7 pin event.
+        /// </summary>
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO7 pin event.")]
+        public ushort DO7TimeBelowThreshold { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the DO7TimeBelowThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO7TimeBelowThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO7 pin event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO7TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.LoadCells.DO7TimeBelowThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time (ms) below threshold value that is required to trigger a DO7 pin event.
+    /// </summary>
+    [DisplayName("TimestampedDO7TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO7 pin event.")]
+    public partial class CreateTimestampedDO7TimeBelowThresholdPayload : CreateDO7TimeBelowThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO7 pin event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO7TimeBelowThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.LoadCells.DO7TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables the data acquisition.
+    /// that time (ms) below threshold value that is required to trigger a DO8 pin event.
     /// </summary>
-    [DisplayName("AcquisitionStatePayload")]
-    [Description("Creates a message payload that enables the data acquisition.")]
-    public partial class CreateAcquisitionStatePayload
+    [DisplayName("DO8TimeBelowThresholdPayload")]
+    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO8 pin event.")]
+    public partial class CreateDO8TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables the data acquisition.
+        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO8 pin event.
         /// </summary>
-        [Description("The value that enables the data acquisition.")]
-        public EnableFlag AcquisitionState { get; set; }
+        [Description("The value that time (ms) below threshold value that is required to trigger a DO8 pin event.")]
+        public ushort DO8TimeBelowThreshold { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the AcquisitionState register.
+        /// Creates a message payload for the DO8TimeBelowThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public ushort GetPayload()
         {
-            return AcquisitionState;
+            return DO8TimeBelowThreshold;
         }
 
         /// <summary>
-        /// Creates a message that enables the data acquisition.
+        /// Creates a message that time (ms) below threshold value that is required to trigger a DO8 pin event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the AcquisitionState register.</returns>
+        /// <returns>A new message for the DO8TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.AcquisitionState.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DO8TimeBelowThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables the data acquisition.
+    /// that time (ms) below threshold value that is required to trigger a DO8 pin event.
     /// </summary>
-    [DisplayName("TimestampedAcquisitionStatePayload")]
-    [Description("Creates a timestamped message payload that enables the data acquisition.")]
-    public partial class CreateTimestampedAcquisitionStatePayload : CreateAcquisitionStatePayload
+    [DisplayName("TimestampedDO8TimeBelowThresholdPayload")]
+    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO8 pin event.")]
+    public partial class CreateTimestampedDO8TimeBelowThresholdPayload : CreateDO8TimeBelowThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables the data acquisition.
+        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO8 pin event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the AcquisitionState register.</returns>
+        /// <returns>A new timestamped message for the DO8TimeBelowThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.AcquisitionState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DO8TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value of single ADC read from all load cell channels.
+    /// that specifies the active events in the device.
     /// </summary>
-    [DisplayName("LoadCellDataPayload")]
-    [Description("Creates a message payload that value of single ADC read from all load cell channels.")]
-    public partial class CreateLoadCellDataPayload
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that specifies the active events in the device.")]
+    public partial class CreateEnableEventsPayload
     {
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel0.
-        /// </summary>
-        [Description("")]
-        public short Channel0 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel1.
-        /// </summary>
-        [Description("")]
-        public short Channel1 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel2.
-        /// </summary>
-        [Description("")]
-        public short Channel2 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel3.
-        /// </summary>
-        [Description("")]
-        public short Channel3 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel4.
-        /// </summary>
-        [Description("")]
-        public short Channel4 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel5.
-        /// </summary>
-        [Description("")]
-        public short Channel5 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel6.
-        /// </summary>
-        [Description("")]
-        public short Channel6 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel7.
+        /// Gets or sets the value that specifies the active events in the device.
         /// </summary>
-        [Description("")]
-        public short Channel7 { get; set; }
+        [Description("The value that specifies the active events in the device.")]
+        public LoadCellEvents EnableEvents { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the LoadCellData register.
+        /// Creates a message payload for the EnableEvents register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellDataPayload GetPayload()
+        public LoadCellEvents GetPayload()
         {
-            LoadCellDataPayload value;
-            value.Channel0 = Channel0;
-            value.Channel1 = Channel1;
-            value.Channel2 = Channel2;
-            value.Channel3 = Channel3;
-            value.Channel4 = Channel4;
-            value.Channel5 = Channel5;
-            value.Channel6 = Channel6;
-            value.Channel7 = Channel7;
-            return value;
+            return EnableEvents;
         }
 
         /// <summary>
-        /// Creates a message that value of single ADC read from all load cell channels.
+        /// Creates a message that specifies the active events in the device.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the LoadCellData register.</returns>
+        /// <returns>A new message for the EnableEvents register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.LoadCellData.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.EnableEvents.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value of single ADC read from all load cell channels.
+    /// that specifies the active events in the device.
     /// </summary>
-    [DisplayName("TimestampedLoadCellDataPayload")]
-    [Description("Creates a timestamped message payload that value of single ADC read from all load cell channels.")]
-    public partial class CreateTimestampedLoadCellDataPayload : CreateLoadCellDataPayload
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value of single ADC read from all load cell channels.
+        /// Creates a timestamped message that specifies the active events in the device.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the LoadCellData register.</returns>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.LoadCellData.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+    /// that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("SampleRatePayload")]
+    [Description("Creates a message payload that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.")]
+    public partial class CreateSampleRatePayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+        /// Gets or sets the value that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.
         /// </summary>
-        [Description("The value that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The value that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.")]
+        public SampleRateConfig SampleRate { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Creates a message payload for the SampleRate register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
+        public SampleRateConfig GetPayload()
         {
-            return DigitalInputState;
+            return SampleRate;
         }
 
         /// <summary>
-        /// Creates a message that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+        /// Creates a message that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the SampleRate register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.SampleRate.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+    /// that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedSampleRatePayload")]
+    [Description("Creates a timestamped message payload that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.")]
+    public partial class CreateTimestampedSampleRatePayload : CreateSampleRatePayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the digital input pin 0. An event will be emitted when DI0Trigger == None.
+        /// Creates a timestamped message that specifies the sample rate of the load cell channels. Threshold times are rounded up to whole sample periods.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the SampleRate register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.SampleRate.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+    /// that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.
     /// </summary>
-    [DisplayName("SyncOutputStatePayload")]
-    [Description("Creates a message payload that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.")]
-    public partial class CreateSyncOutputStatePayload
+    [DisplayName("DecimationPayload")]
+    [Description("Creates a message payload that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.")]
+    public partial class CreateDecimationPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+        /// Gets or sets the value that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.
         /// </summary>
-        [Description("The value that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.")]
-        public SyncOutputs SyncOutputState { get; set; }
+        [Description("The value that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.")]
+        public DecimationConfig Decimation { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SyncOutputState register.
+        /// Creates a message payload for the Decimation register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public SyncOutputs GetPayload()
+        public DecimationConfig GetPayload()
         {
-            return SyncOutputState;
+            return Decimation;
         }
 
         /// <summary>
-        /// Creates a message that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+        /// Creates a message that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SyncOutputState register.</returns>
+        /// <returns>A new message for the Decimation register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.SyncOutputState.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.Decimation.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+    /// that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.
     /// </summary>
-    [DisplayName("TimestampedSyncOutputStatePayload")]
-    [Description("Creates a timestamped message payload that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.")]
-    public partial class CreateTimestampedSyncOutputStatePayload : CreateSyncOutputStatePayload
+    [DisplayName("TimestampedDecimationPayload")]
+    [Description("Creates a timestamped message payload that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.")]
+    public partial class CreateTimestampedDecimationPayload : CreateDecimationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the digital output pin 0. An periodic event will be emitted when DO0Sync == ToggleEachSecond.
+        /// Creates a timestamped message that specifies the number of consecutive samples averaged into each LoadCellData event. Events are sent at the sample rate divided by this number.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SyncOutputState register.</returns>
+        /// <returns>A new timestamped message for the Decimation register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.SyncOutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.Decimation.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital input pin 0.
+    /// that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.
     /// </summary>
-    [DisplayName("DI0TriggerPayload")]
-    [Description("Creates a message payload that configuration of the digital input pin 0.")]
-    public partial class CreateDI0TriggerPayload
+    [DisplayName("LoadCellDataBatchPayload")]
+    [Description("Creates a message payload that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.")]
+    public partial class CreateLoadCellDataBatchPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital input pin 0.
+        /// Gets or sets the value that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.
         /// </summary>
-        [Description("The value that configuration of the digital input pin 0.")]
-        public TriggerConfig DI0Trigger { get; set; }
+        [Description("The value that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.")]
+        public short[] LoadCellDataBatch { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DI0Trigger register.
+        /// Creates a message payload for the LoadCellDataBatch register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public TriggerConfig GetPayload()
+        public short[] GetPayload()
         {
-            return DI0Trigger;
+            return LoadCellDataBatch;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital input pin 0.
+        /// Creates a message that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0Trigger register.</returns>
+        /// <returns>A new message for the LoadCellDataBatch register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DI0Trigger.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.LoadCellDataBatch.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital input pin 0.
+    /// that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.
     /// </summary>
-    [DisplayName("TimestampedDI0TriggerPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital input pin 0.")]
-    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    [DisplayName("TimestampedLoadCellDataBatchPayload")]
+    [Description("Creates a timestamped message payload that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.")]
+    public partial class CreateTimestampedLoadCellDataBatchPayload : CreateLoadCellDataBatchPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital input pin 0.
+        /// Creates a timestamped message that consecutive LoadCellData frames of eight channels each, sent in a single event with the timestamp of the first frame. Only BatchSize frames are included in each event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        /// <returns>A new timestamped message for the LoadCellDataBatch register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.LoadCellDataBatch.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital output pin 0.
+    /// that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.
     /// </summary>
-    [DisplayName("DO0SyncPayload")]
-    [Description("Creates a message payload that configuration of the digital output pin 0.")]
-    public partial class CreateDO0SyncPayload
+    [DisplayName("BatchSizePayload")]
+    [Description("Creates a message payload that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.")]
+    public partial class CreateBatchSizePayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital output pin 0.
+        /// Gets or sets the value that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.
         /// </summary>
-        [Description("The value that configuration of the digital output pin 0.")]
-        public SyncConfig DO0Sync { get; set; }
+        [Range(min: 1, max: 15)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.")]
+        public byte BatchSize { get; set; } = 1;
 
         /// <summary>
-        /// Creates a message payload for the DO0Sync register.
+        /// Creates a message payload for the BatchSize register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public SyncConfig GetPayload()
+        public byte GetPayload()
         {
-            return DO0Sync;
+            return BatchSize;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital output pin 0.
+        /// Creates a message that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Sync register.</returns>
+        /// <returns>A new message for the BatchSize register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO0Sync.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.BatchSize.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital output pin 0.
+    /// that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.
     /// </summary>
-    [DisplayName("TimestampedDO0SyncPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital output pin 0.")]
-    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    [DisplayName("TimestampedBatchSizePayload")]
+    [Description("Creates a timestamped message payload that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.")]
+    public partial class CreateTimestampedBatchSizePayload : CreateBatchSizePayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital output pin 0.
+        /// Creates a timestamped message that specifies the number of LoadCellData frames included in each LoadCellDataBatch event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        /// <returns>A new timestamped message for the BatchSize register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.BatchSize.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.
     /// </summary>
-    [DisplayName("DO0PulseWidthPayload")]
-    [Description("Creates a message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
-    public partial class CreateDO0PulseWidthPayload
+    [DisplayName("EnablePortsPayload")]
+    [Description("Creates a message payload that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.")]
+    public partial class CreateEnablePortsPayload
     {
         /// <summary>
-        /// Gets or sets the value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// Gets or sets the value that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.
         /// </summary>
-        [Range(min: 1, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
-        public byte DO0PulseWidth { get; set; } = 1;
+        [Description("The value that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.")]
+        public LoadCellPorts EnablePorts { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0PulseWidth register.
+        /// Creates a message payload for the EnablePorts register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public LoadCellPorts GetPayload()
         {
-            return DO0PulseWidth;
+            return EnablePorts;
         }
 
         /// <summary>
-        /// Creates a message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// Creates a message that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        /// <returns>A new message for the EnablePorts register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO0PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.EnablePorts.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+    /// that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.
     /// </summary>
-    [DisplayName("TimestampedDO0PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.")]
-    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    [DisplayName("TimestampedEnablePortsPayload")]
+    [Description("Creates a timestamped message payload that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.")]
+    public partial class CreateTimestampedEnablePortsPayload : CreateEnablePortsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that pulse duration (ms) for the digital output pin 0. The pulse will only be emitted when DO0Sync == Pulse.
+        /// Creates a timestamped message that specifies the ports that are converted and read. LoadCellData and LoadCellDataBatch frames only include the channels of the enabled ports.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the EnablePorts register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.EnablePorts.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.
     /// </summary>
-    [DisplayName("DigitalOutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateDigitalOutputSetPayload
+    [DisplayName("ThresholdsModePayload")]
+    [Description("Creates a message payload that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.")]
+    public partial class CreateThresholdsModePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputSet { get; set; }
+        [Description("The value that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.")]
+        public ThresholdsModeConfig ThresholdsMode { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputSet register.
+        /// Creates a message payload for the ThresholdsMode register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ThresholdsModeConfig GetPayload()
         {
-            return DigitalOutputSet;
+            return ThresholdsMode;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        /// <returns>A new message for the ThresholdsMode register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputSet.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdsMode.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    [DisplayName("TimestampedThresholdsModePayload")]
+    [Description("Creates a timestamped message payload that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.")]
+    public partial class CreateTimestampedThresholdsModePayload : CreateThresholdsModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that specifies whether the thresholds are evaluated on the reported samples or on every sample as soon as it is read.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        /// <returns>A new timestamped message for the ThresholdsMode register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdsMode.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clear the specified digital output lines.
+    /// that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.
     /// </summary>
-    [DisplayName("DigitalOutputClearPayload")]
-    [Description("Creates a message payload that clear the specified digital output lines.")]
-    public partial class CreateDigitalOutputClearPayload
+    [DisplayName("ThresholdsLatencyPayload")]
+    [Description("Creates a message payload that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.")]
+    public partial class CreateThresholdsLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that clear the specified digital output lines.
+        /// Gets or sets the value that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.
         /// </summary>
-        [Description("The value that clear the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputClear { get; set; }
+        [Description("The value that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.")]
+        public ushort ThresholdsLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputClear register.
+        /// Creates a message payload for the ThresholdsLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort GetPayload()
         {
-            return DigitalOutputClear;
+            return ThresholdsLatency;
         }
 
         /// <summary>
-        /// Creates a message that clear the specified digital output lines.
+        /// Creates a message that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        /// <returns>A new message for the ThresholdsLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputClear.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdsLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clear the specified digital output lines.
+    /// that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    [DisplayName("TimestampedThresholdsLatencyPayload")]
+    [Description("Creates a timestamped message payload that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.")]
+    public partial class CreateTimestampedThresholdsLatencyPayload : CreateThresholdsLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that clear the specified digital output lines.
+        /// Creates a timestamped message that time, in microseconds, from the start of the conversion to the last digital output change made by the thresholds.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        /// <returns>A new timestamped message for the ThresholdsLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdsLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that toggle the specified digital output lines.
+    /// that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.
     /// </summary>
-    [DisplayName("DigitalOutputTogglePayload")]
-    [Description("Creates a message payload that toggle the specified digital output lines.")]
-    public partial class CreateDigitalOutputTogglePayload
+    [DisplayName("AutoZeroPayload")]
+    [Description("Creates a message payload that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.")]
+    public partial class CreateAutoZeroPayload
     {
         /// <summary>
-        /// Gets or sets the value that toggle the specified digital output lines.
+        /// Gets or sets the value that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.
         /// </summary>
-        [Description("The value that toggle the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputToggle { get; set; }
+        [Description("The value that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.")]
+        public LoadCellChannels AutoZero { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputToggle register.
+        /// Creates a message payload for the AutoZero register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public LoadCellChannels GetPayload()
         {
-            return DigitalOutputToggle;
+            return AutoZero;
         }
 
         /// <summary>
-        /// Creates a message that toggle the specified digital output lines.
+        /// Creates a message that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        /// <returns>A new message for the AutoZero register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.AutoZero.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that toggle the specified digital output lines.
+    /// that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputTogglePayload")]
-    [Description("Creates a timestamped message payload that toggle the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    [DisplayName("TimestampedAutoZeroPayload")]
+    [Description("Creates a timestamped message payload that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.")]
+    public partial class CreateTimestampedAutoZeroPayload : CreateAutoZeroPayload
     {
         /// <summary>
-        /// Creates a timestamped message that toggle the specified digital output lines.
+        /// Creates a timestamped message that starts the search of the offset that brings each specified channel closest to zero. Reads the channels still being zeroed, and an event is emitted when all are done. A search cut short by a reset is not resumed.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        /// <returns>A new timestamped message for the AutoZero register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.AutoZero.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// that counters of how close the device is to its limits. Writing any value resets all of them.
     /// </summary>
-    [DisplayName("DigitalOutputStatePayload")]
-    [Description("Creates a message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
-    public partial class CreateDigitalOutputStatePayload
+    [DisplayName("PerformanceCountersPayload")]
+    [Description("Creates a message payload that counters of how close the device is to its limits. Writing any value resets all of them.")]
+    public partial class CreatePerformanceCountersPayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// Gets or sets a value to write on payload member SamplesAcquired.
         /// </summary>
-        [Description("The value that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
-        public DigitalOutputs DigitalOutputState { get; set; }
+        [Description("Samples read from the ADCs.")]
+        public uint SamplesAcquired { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputState register.
+        /// Gets or sets a value to write on payload member SamplesDropped.
+        /// </summary>
+        [Description("Conversions lost because the readout of the previous sample was still on going.")]
+        public uint SamplesDropped { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member EventsDropped.
+        /// </summary>
+        [Description("Load cell events not sent because the transmit buffer was full.")]
+        public uint EventsDropped { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member ReadoutMaxCycles.
+        /// </summary>
+        [Description("Longest processing of a sample after its readout, in CPU cycles.")]
+        public uint ReadoutMaxCycles { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member ThresholdsMaxCycles.
+        /// </summary>
+        [Description("Longest evaluation of the thresholds, in CPU cycles.")]
+        public uint ThresholdsMaxCycles { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TransmitBufferMax.
+        /// </summary>
+        [Description("Most bytes waiting in the transmit buffer.")]
+        public uint TransmitBufferMax { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member DigitalInputEdgesDropped.
+        /// </summary>
+        [Description("Edges of the digital input pin 0 lost because the capture buffer or the queue was full.")]
+        public uint DigitalInputEdgesDropped { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member ScheduleEntriesMerged.
+        /// </summary>
+        [Description("Entries of DoSchedule with a delay that were played late, right after the entry before them.")]
+        public uint ScheduleEntriesMerged { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PerformanceCounters register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
-        {
-            return DigitalOutputState;
+        public PerformanceCountersPayload GetPayload()
+        {
+            PerformanceCountersPayload value;
+            value.SamplesAcquired = SamplesAcquired;
+            value.SamplesDropped = SamplesDropped;
+            value.EventsDropped = EventsDropped;
+            value.ReadoutMaxCycles = ReadoutMaxCycles;
+            value.ThresholdsMaxCycles = ThresholdsMaxCycles;
+            value.TransmitBufferMax = TransmitBufferMax;
+            value.DigitalInputEdgesDropped = DigitalInputEdgesDropped;
+            value.ScheduleEntriesMerged = ScheduleEntriesMerged;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// Creates a message that counters of how close the device is to its limits. Writing any value resets all of them.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputState register.</returns>
+        /// <returns>A new message for the PerformanceCounters register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputState.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.PerformanceCounters.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+    /// that counters of how close the device is to its limits. Writing any value resets all of them.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.")]
-    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    [DisplayName("TimestampedPerformanceCountersPayload")]
+    [Description("Creates a timestamped message payload that counters of how close the device is to its limits. Writing any value resets all of them.")]
+    public partial class CreateTimestampedPerformanceCountersPayload : CreatePerformanceCountersPayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all digital output lines. An event will be emitted when the value of any pin was changed by a threshold event.
+        /// Creates a timestamped message that counters of how close the device is to its limits. Writing any value resets all of them.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        /// <returns>A new timestamped message for the PerformanceCounters register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.PerformanceCounters.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 0.
+    /// that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.
     /// </summary>
-    [DisplayName("OffsetLoadCell0Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 0.")]
-    public partial class CreateOffsetLoadCell0Payload
+    [DisplayName("EnableSequencePayload")]
+    [Description("Creates a message payload that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.")]
+    public partial class CreateEnableSequencePayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 0.
+        /// Gets or sets the value that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 0.")]
-        public short OffsetLoadCell0 { get; set; } = 0;
+        [Description("The value that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.")]
+        public EnableFlag EnableSequence { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell0 register.
+        /// Creates a message payload for the EnableSequence register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public EnableFlag GetPayload()
         {
-            return OffsetLoadCell0;
+            return EnableSequence;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 0.
+        /// Creates a message that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell0 register.</returns>
+        /// <returns>A new message for the EnableSequence register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell0.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.EnableSequence.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 0.
+    /// that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell0Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 0.")]
-    public partial class CreateTimestampedOffsetLoadCell0Payload : CreateOffsetLoadCell0Payload
+    [DisplayName("TimestampedEnableSequencePayload")]
+    [Description("Creates a timestamped message payload that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.")]
+    public partial class CreateTimestampedEnableSequencePayload : CreateEnableSequencePayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 0.
+        /// Creates a timestamped message that appends the sequence number of the sample to each LoadCellData and LoadCellDataBatch frame. The number counts every conversion, so missing numbers are samples lost on the way.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell0 register.</returns>
+        /// <returns>A new timestamped message for the EnableSequence register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell0.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.EnableSequence.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 1.
+    /// that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.
     /// </summary>
-    [DisplayName("OffsetLoadCell1Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 1.")]
-    public partial class CreateOffsetLoadCell1Payload
+    [DisplayName("DeltaKeyframeIntervalPayload")]
+    [Description("Creates a message payload that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.")]
+    public partial class CreateDeltaKeyframeIntervalPayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 1.
+        /// Gets or sets the value that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 1.")]
-        public short OffsetLoadCell1 { get; set; } = 0;
+        [Description("The value that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.")]
+        public byte DeltaKeyframeInterval { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell1 register.
+        /// Creates a message payload for the DeltaKeyframeInterval register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public byte GetPayload()
         {
-            return OffsetLoadCell1;
+            return DeltaKeyframeInterval;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 1.
+        /// Creates a message that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell1 register.</returns>
+        /// <returns>A new message for the DeltaKeyframeInterval register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell1.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DeltaKeyframeInterval.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 1.
+    /// that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell1Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 1.")]
-    public partial class CreateTimestampedOffsetLoadCell1Payload : CreateOffsetLoadCell1Payload
+    [DisplayName("TimestampedDeltaKeyframeIntervalPayload")]
+    [Description("Creates a timestamped message payload that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.")]
+    public partial class CreateTimestampedDeltaKeyframeIntervalPayload : CreateDeltaKeyframeIntervalPayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 1.
+        /// Creates a timestamped message that specifies the number of frames between full LoadCellData events. The frames in between are sent as LoadCellDataDelta events. Zero always sends full frames.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell1 register.</returns>
+        /// <returns>A new timestamped message for the DeltaKeyframeInterval register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell1.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DeltaKeyframeInterval.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 2.
+    /// that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.
     /// </summary>
-    [DisplayName("OffsetLoadCell2Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 2.")]
-    public partial class CreateOffsetLoadCell2Payload
+    [DisplayName("LoadCellDataDeltaPayload")]
+    [Description("Creates a message payload that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.")]
+    public partial class CreateLoadCellDataDeltaPayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 2.
+        /// Gets or sets the value that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 2.")]
-        public short OffsetLoadCell2 { get; set; } = 0;
+        [Description("The value that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.")]
+        public sbyte[] LoadCellDataDelta { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell2 register.
+        /// Creates a message payload for the LoadCellDataDelta register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public sbyte[] GetPayload()
         {
-            return OffsetLoadCell2;
+            return LoadCellDataDelta;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 2.
+        /// Creates a message that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell2 register.</returns>
+        /// <returns>A new message for the LoadCellDataDelta register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell2.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.LoadCellDataDelta.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 2.
+    /// that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell2Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 2.")]
-    public partial class CreateTimestampedOffsetLoadCell2Payload : CreateOffsetLoadCell2Payload
+    [DisplayName("TimestampedLoadCellDataDeltaPayload")]
+    [Description("Creates a timestamped message payload that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.")]
+    public partial class CreateTimestampedLoadCellDataDeltaPayload : CreateLoadCellDataDeltaPayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 2.
+        /// Creates a timestamped message that difference of each enabled channel to the previous frame, sent instead of LoadCellData when the channels change by less than 128. The low byte of the sequence number follows the channels when EnableSequence is set.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell2 register.</returns>
+        /// <returns>A new timestamped message for the LoadCellDataDelta register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell2.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.LoadCellDataDelta.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 3.
+    /// that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.
     /// </summary>
-    [DisplayName("OffsetLoadCell3Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 3.")]
-    public partial class CreateOffsetLoadCell3Payload
+    [DisplayName("DeadbandPayload")]
+    [Description("Creates a message payload that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.")]
+    public partial class CreateDeadbandPayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 3.
+        /// Gets or sets the value that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 3.")]
-        public short OffsetLoadCell3 { get; set; } = 0;
+        [Description("The value that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.")]
+        public ushort Deadband { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell3 register.
+        /// Creates a message payload for the Deadband register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public ushort GetPayload()
         {
-            return OffsetLoadCell3;
+            return Deadband;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 3.
+        /// Creates a message that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell3 register.</returns>
+        /// <returns>A new message for the Deadband register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell3.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.Deadband.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 3.
+    /// that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell3Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 3.")]
-    public partial class CreateTimestampedOffsetLoadCell3Payload : CreateOffsetLoadCell3Payload
+    [DisplayName("TimestampedDeadbandPayload")]
+    [Description("Creates a timestamped message payload that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.")]
+    public partial class CreateTimestampedDeadbandPayload : CreateDeadbandPayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 3.
+        /// Creates a timestamped message that change of any enabled channel, in ADC units, below which LoadCellData is not sent. The first frame sent after skipped ones is a full frame, and the skipped frames show as gaps of the sequence number. Zero sends every frame.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell3 register.</returns>
+        /// <returns>A new timestamped message for the Deadband register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell3.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.Deadband.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 4.
+    /// that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.
     /// </summary>
-    [DisplayName("OffsetLoadCell4Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 4.")]
-    public partial class CreateOffsetLoadCell4Payload
+    [DisplayName("DeadbandHeartbeatPayload")]
+    [Description("Creates a message payload that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.")]
+    public partial class CreateDeadbandHeartbeatPayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 4.
+        /// Gets or sets the value that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 4.")]
-        public short OffsetLoadCell4 { get; set; } = 0;
+        [Description("The value that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.")]
+        public ushort DeadbandHeartbeat { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell4 register.
+        /// Creates a message payload for the DeadbandHeartbeat register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public ushort GetPayload()
         {
-            return OffsetLoadCell4;
+            return DeadbandHeartbeat;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 4.
+        /// Creates a message that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell4 register.</returns>
+        /// <returns>A new message for the DeadbandHeartbeat register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell4.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DeadbandHeartbeat.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 4.
+    /// that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell4Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 4.")]
-    public partial class CreateTimestampedOffsetLoadCell4Payload : CreateOffsetLoadCell4Payload
+    [DisplayName("TimestampedDeadbandHeartbeatPayload")]
+    [Description("Creates a timestamped message payload that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.")]
+    public partial class CreateTimestampedDeadbandHeartbeatPayload : CreateDeadbandHeartbeatPayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 4.
+        /// Creates a timestamped message that maximum time, in milliseconds, without LoadCellData while the channels stay within the Deadband. Zero disables the heartbeat.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell4 register.</returns>
+        /// <returns>A new timestamped message for the DeadbandHeartbeat register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell4.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DeadbandHeartbeat.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 5.
+    /// that specifies the filter applied to each sample of the filtered channels, right after it is read.
     /// </summary>
-    [DisplayName("OffsetLoadCell5Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 5.")]
-    public partial class CreateOffsetLoadCell5Payload
+    [DisplayName("FilterModePayload")]
+    [Description("Creates a message payload that specifies the filter applied to each sample of the filtered channels, right after it is read.")]
+    public partial class CreateFilterModePayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 5.
+        /// Gets or sets the value that specifies the filter applied to each sample of the filtered channels, right after it is read.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 5.")]
-        public short OffsetLoadCell5 { get; set; } = 0;
+        [Description("The value that specifies the filter applied to each sample of the filtered channels, right after it is read.")]
+        public FilterModeConfig FilterMode { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell5 register.
+        /// Creates a message payload for the FilterMode register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public FilterModeConfig GetPayload()
         {
-            return OffsetLoadCell5;
+            return FilterMode;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 5.
+        /// Creates a message that specifies the filter applied to each sample of the filtered channels, right after it is read.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell5 register.</returns>
+        /// <returns>A new message for the FilterMode register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell5.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.FilterMode.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 5.
+    /// that specifies the filter applied to each sample of the filtered channels, right after it is read.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell5Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 5.")]
-    public partial class CreateTimestampedOffsetLoadCell5Payload : CreateOffsetLoadCell5Payload
+    [DisplayName("TimestampedFilterModePayload")]
+    [Description("Creates a timestamped message payload that specifies the filter applied to each sample of the filtered channels, right after it is read.")]
+    public partial class CreateTimestampedFilterModePayload : CreateFilterModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 5.
+        /// Creates a timestamped message that specifies the filter applied to each sample of the filtered channels, right after it is read.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell5 register.</returns>
+        /// <returns>A new timestamped message for the FilterMode register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell5.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.FilterMode.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 6.
+    /// that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.
     /// </summary>
-    [DisplayName("OffsetLoadCell6Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 6.")]
-    public partial class CreateOffsetLoadCell6Payload
+    [DisplayName("FilterLengthPayload")]
+    [Description("Creates a message payload that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.")]
+    public partial class CreateFilterLengthPayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 6.
+        /// Gets or sets the value that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.
         /// </summary>
-        [Range(min: -255, max: 255)]
+        [Range(min: 0, max: 8)]
         [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 6.")]
-        public short OffsetLoadCell6 { get; set; } = 0;
+        [Description("The value that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.")]
+        public byte FilterLength { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell6 register.
+        /// Creates a message payload for the FilterLength register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public byte GetPayload()
         {
-            return OffsetLoadCell6;
+            return FilterLength;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 6.
+        /// Creates a message that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell6 register.</returns>
+        /// <returns>A new message for the FilterLength register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell6.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.FilterLength.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 6.
+    /// that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell6Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 6.")]
-    public partial class CreateTimestampedOffsetLoadCell6Payload : CreateOffsetLoadCell6Payload
+    [DisplayName("TimestampedFilterLengthPayload")]
+    [Description("Creates a timestamped message payload that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.")]
+    public partial class CreateTimestampedFilterLengthPayload : CreateFilterLengthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 6.
+        /// Creates a timestamped message that base 2 logarithm of the number of samples spanned by the filter. The moving average is limited to 4, or 16 samples.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell6 register.</returns>
+        /// <returns>A new timestamped message for the FilterLength register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell6.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.FilterLength.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that offset value for Load Cell channel 7.
+    /// that specifies the channels that are filtered.
     /// </summary>
-    [DisplayName("OffsetLoadCell7Payload")]
-    [Description("Creates a message payload that offset value for Load Cell channel 7.")]
-    public partial class CreateOffsetLoadCell7Payload
+    [DisplayName("FilterChannelsPayload")]
+    [Description("Creates a message payload that specifies the channels that are filtered.")]
+    public partial class CreateFilterChannelsPayload
     {
         /// <summary>
-        /// Gets or sets the value that offset value for Load Cell channel 7.
+        /// Gets or sets the value that specifies the channels that are filtered.
         /// </summary>
-        [Range(min: -255, max: 255)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that offset value for Load Cell channel 7.")]
-        public short OffsetLoadCell7 { get; set; } = 0;
+        [Description("The value that specifies the channels that are filtered.")]
+        public LoadCellChannels FilterChannels { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OffsetLoadCell7 register.
+        /// Creates a message payload for the FilterChannels register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public LoadCellChannels GetPayload()
         {
-            return OffsetLoadCell7;
+            return FilterChannels;
         }
 
         /// <summary>
-        /// Creates a message that offset value for Load Cell channel 7.
+        /// Creates a message that specifies the channels that are filtered.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OffsetLoadCell7 register.</returns>
+        /// <returns>A new message for the FilterChannels register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell7.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.FilterChannels.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that offset value for Load Cell channel 7.
+    /// that specifies the channels that are filtered.
     /// </summary>
-    [DisplayName("TimestampedOffsetLoadCell7Payload")]
-    [Description("Creates a timestamped message payload that offset value for Load Cell channel 7.")]
-    public partial class CreateTimestampedOffsetLoadCell7Payload : CreateOffsetLoadCell7Payload
+    [DisplayName("TimestampedFilterChannelsPayload")]
+    [Description("Creates a timestamped message payload that specifies the channels that are filtered.")]
+    public partial class CreateTimestampedFilterChannelsPayload : CreateFilterChannelsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that offset value for Load Cell channel 7.
+        /// Creates a timestamped message that specifies the channels that are filtered.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OffsetLoadCell7 register.</returns>
+        /// <returns>A new timestamped message for the FilterChannels register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.OffsetLoadCell7.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.FilterChannels.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+    /// that specifies whether the thresholds and the reported load cell data use the filtered channels.
     /// </summary>
-    [DisplayName("DO1TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO1 pin.")]
-    public partial class CreateDO1TargetLoadCellPayload
+    [DisplayName("FilterTargetsPayload")]
+    [Description("Creates a message payload that specifies whether the thresholds and the reported load cell data use the filtered channels.")]
+    public partial class CreateFilterTargetsPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+        /// Gets or sets the value that specifies whether the thresholds and the reported load cell data use the filtered channels.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO1 pin.")]
-        public LoadCellChannel DO1TargetLoadCell { get; set; }
+        [Description("The value that specifies whether the thresholds and the reported load cell data use the filtered channels.")]
+        public FilterTargets FilterTargets { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1TargetLoadCell register.
+        /// Creates a message payload for the FilterTargets register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
+        public FilterTargets GetPayload()
         {
-            return DO1TargetLoadCell;
+            return FilterTargets;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+        /// Creates a message that specifies whether the thresholds and the reported load cell data use the filtered channels.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1TargetLoadCell register.</returns>
+        /// <returns>A new message for the FilterTargets register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO1TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.FilterTargets.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+    /// that specifies whether the thresholds and the reported load cell data use the filtered channels.
     /// </summary>
-    [DisplayName("TimestampedDO1TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO1 pin.")]
-    public partial class CreateTimestampedDO1TargetLoadCellPayload : CreateDO1TargetLoadCellPayload
+    [DisplayName("TimestampedFilterTargetsPayload")]
+    [Description("Creates a timestamped message payload that specifies whether the thresholds and the reported load cell data use the filtered channels.")]
+    public partial class CreateTimestampedFilterTargetsPayload : CreateFilterTargetsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO1 pin.
+        /// Creates a timestamped message that specifies whether the thresholds and the reported load cell data use the filtered channels.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the FilterTargets register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO1TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.FilterTargets.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+    /// that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.
     /// </summary>
-    [DisplayName("DO2TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO2 pin.")]
-    public partial class CreateDO2TargetLoadCellPayload
+    [DisplayName("VirtualChannelWeightsPayload")]
+    [Description("Creates a message payload that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.")]
+    public partial class CreateVirtualChannelWeightsPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+        /// Gets or sets the value that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO2 pin.")]
-        public LoadCellChannel DO2TargetLoadCell { get; set; }
+        [Description("The value that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.")]
+        public sbyte[] VirtualChannelWeights { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO2TargetLoadCell register.
+        /// Creates a message payload for the VirtualChannelWeights register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
+        public sbyte[] GetPayload()
         {
-            return DO2TargetLoadCell;
+            return VirtualChannelWeights;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+        /// Creates a message that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2TargetLoadCell register.</returns>
+        /// <returns>A new message for the VirtualChannelWeights register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO2TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.VirtualChannelWeights.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+    /// that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.
     /// </summary>
-    [DisplayName("TimestampedDO2TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO2 pin.")]
-    public partial class CreateTimestampedDO2TargetLoadCellPayload : CreateDO2TargetLoadCellPayload
+    [DisplayName("TimestampedVirtualChannelWeightsPayload")]
+    [Description("Creates a timestamped message payload that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.")]
+    public partial class CreateTimestampedVirtualChannelWeightsPayload : CreateVirtualChannelWeightsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO2 pin.
+        /// Creates a timestamped message that weight of each load cell channel in each virtual channel. Elements 0 to 7 are the weights of virtual channel 0, 8 to 15 those of virtual channel 1, and so on.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the VirtualChannelWeights register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO2TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.VirtualChannelWeights.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+    /// that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.
     /// </summary>
-    [DisplayName("DO3TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO3 pin.")]
-    public partial class CreateDO3TargetLoadCellPayload
+    [DisplayName("VirtualChannelShiftPayload")]
+    [Description("Creates a message payload that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.")]
+    public partial class CreateVirtualChannelShiftPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+        /// Gets or sets the value that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO3 pin.")]
-        public LoadCellChannel DO3TargetLoadCell { get; set; }
+        [Description("The value that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.")]
+        public byte[] VirtualChannelShift { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO3TargetLoadCell register.
+        /// Creates a message payload for the VirtualChannelShift register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
+        public byte[] GetPayload()
         {
-            return DO3TargetLoadCell;
+            return VirtualChannelShift;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+        /// Creates a message that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3TargetLoadCell register.</returns>
+        /// <returns>A new message for the VirtualChannelShift register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO3TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.VirtualChannelShift.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+    /// that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.
     /// </summary>
-    [DisplayName("TimestampedDO3TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO3 pin.")]
-    public partial class CreateTimestampedDO3TargetLoadCellPayload : CreateDO3TargetLoadCellPayload
+    [DisplayName("TimestampedVirtualChannelShiftPayload")]
+    [Description("Creates a timestamped message payload that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.")]
+    public partial class CreateTimestampedVirtualChannelShiftPayload : CreateVirtualChannelShiftPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO3 pin.
+        /// Creates a timestamped message that number of bits each virtual channel is shifted right after the weighted sum, from 0 to 15. The result saturates to the 16-bit range.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the VirtualChannelShift register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO3TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.VirtualChannelShift.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+    /// that virtual channels computed from each LoadCellData frame, with the same timestamp.
     /// </summary>
-    [DisplayName("DO4TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO4 pin.")]
-    public partial class CreateDO4TargetLoadCellPayload
+    [DisplayName("LoadCellDataVirtualPayload")]
+    [Description("Creates a message payload that virtual channels computed from each LoadCellData frame, with the same timestamp.")]
+    public partial class CreateLoadCellDataVirtualPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+        /// Gets or sets a value to write on payload member Virtual0.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO4 pin.")]
-        public LoadCellChannel DO4TargetLoadCell { get; set; }
+        [Description("")]
+        public short Virtual0 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO4TargetLoadCell register.
+        /// Gets or sets a value to write on payload member Virtual1.
+        /// </summary>
+        [Description("")]
+        public short Virtual1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Virtual2.
+        /// </summary>
+        [Description("")]
+        public short Virtual2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Virtual3.
+        /// </summary>
+        [Description("")]
+        public short Virtual3 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LoadCellDataVirtual register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
+        public LoadCellDataVirtualPayload GetPayload()
         {
-            return DO4TargetLoadCell;
+            LoadCellDataVirtualPayload value;
+            value.Virtual0 = Virtual0;
+            value.Virtual1 = Virtual1;
+            value.Virtual2 = Virtual2;
+            value.Virtual3 = Virtual3;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+        /// Creates a message that virtual channels computed from each LoadCellData frame, with the same timestamp.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO4TargetLoadCell register.</returns>
+        /// <returns>A new message for the LoadCellDataVirtual register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO4TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.LoadCellDataVirtual.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+    /// that virtual channels computed from each LoadCellData frame, with the same timestamp.
     /// </summary>
-    [DisplayName("TimestampedDO4TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO4 pin.")]
-    public partial class CreateTimestampedDO4TargetLoadCellPayload : CreateDO4TargetLoadCellPayload
+    [DisplayName("TimestampedLoadCellDataVirtualPayload")]
+    [Description("Creates a timestamped message payload that virtual channels computed from each LoadCellData frame, with the same timestamp.")]
+    public partial class CreateTimestampedLoadCellDataVirtualPayload : CreateLoadCellDataVirtualPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO4 pin.
+        /// Creates a timestamped message that virtual channels computed from each LoadCellData frame, with the same timestamp.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO4TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the LoadCellDataVirtual register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO4TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.LoadCellDataVirtual.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+    /// that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.
     /// </summary>
-    [DisplayName("DO5TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO5 pin.")]
-    public partial class CreateDO5TargetLoadCellPayload
+    [DisplayName("ThresholdComparatorPayload")]
+    [Description("Creates a message payload that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.")]
+    public partial class CreateThresholdComparatorPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO5 pin.")]
-        public LoadCellChannel DO5TargetLoadCell { get; set; }
+        [Description("Comparator of DO1.")]
+        public byte Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO5TargetLoadCell register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Comparator of DO2.")]
+        public byte Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Comparator of DO3.")]
+        public byte Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Comparator of DO4.")]
+        public byte Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Comparator of DO5.")]
+        public byte Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Comparator of DO6.")]
+        public byte Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Comparator of DO7.")]
+        public byte Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Comparator of DO8.")]
+        public byte Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ThresholdComparator register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
-        {
-            return DO5TargetLoadCell;
+        public ThresholdComparatorPayload GetPayload()
+        {
+            ThresholdComparatorPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+        /// Creates a message that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO5TargetLoadCell register.</returns>
+        /// <returns>A new message for the ThresholdComparator register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO5TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdComparator.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+    /// that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.
     /// </summary>
-    [DisplayName("TimestampedDO5TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO5 pin.")]
-    public partial class CreateTimestampedDO5TargetLoadCellPayload : CreateDO5TargetLoadCellPayload
+    [DisplayName("TimestampedThresholdComparatorPayload")]
+    [Description("Creates a timestamped message payload that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.")]
+    public partial class CreateTimestampedThresholdComparatorPayload : CreateThresholdComparatorPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO5 pin.
+        /// Creates a timestamped message that comparator of the threshold of each digital output. Level (0) compares against the DOxThreshold, Hysteresis (1) sets the output at DOxThreshold and releases it below ThresholdLow, Window (2) and OutOfWindow (3) compare against the range from ThresholdLow to DOxThreshold, and Slope (4) compares the change of the input over ThresholdSlopeSamples samples against DOxThreshold.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO5TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the ThresholdComparator register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO5TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdComparator.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+    /// that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.
     /// </summary>
-    [DisplayName("DO6TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO6 pin.")]
-    public partial class CreateDO6TargetLoadCellPayload
+    [DisplayName("ThresholdLowPayload")]
+    [Description("Creates a message payload that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.")]
+    public partial class CreateThresholdLowPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO6 pin.")]
-        public LoadCellChannel DO6TargetLoadCell { get; set; }
+        [Description("Lower threshold of DO1.")]
+        public short Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO6TargetLoadCell register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Lower threshold of DO2.")]
+        public short Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Lower threshold of DO3.")]
+        public short Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Lower threshold of DO4.")]
+        public short Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Lower threshold of DO5.")]
+        public short Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Lower threshold of DO6.")]
+        public short Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Lower threshold of DO7.")]
+        public short Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Lower threshold of DO8.")]
+        public short Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ThresholdLow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
-        {
-            return DO6TargetLoadCell;
+        public ThresholdLowPayload GetPayload()
+        {
+            ThresholdLowPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+        /// Creates a message that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO6TargetLoadCell register.</returns>
+        /// <returns>A new message for the ThresholdLow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO6TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdLow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+    /// that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.
     /// </summary>
-    [DisplayName("TimestampedDO6TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO6 pin.")]
-    public partial class CreateTimestampedDO6TargetLoadCellPayload : CreateDO6TargetLoadCellPayload
+    [DisplayName("TimestampedThresholdLowPayload")]
+    [Description("Creates a timestamped message payload that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.")]
+    public partial class CreateTimestampedThresholdLowPayload : CreateThresholdLowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO6 pin.
+        /// Creates a timestamped message that lower threshold of each digital output, used by the Hysteresis, Window and OutOfWindow comparators.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO6TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the ThresholdLow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO6TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdLow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+    /// that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.
     /// </summary>
-    [DisplayName("DO7TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO7 pin.")]
-    public partial class CreateDO7TargetLoadCellPayload
+    [DisplayName("ThresholdSlopeSamplesPayload")]
+    [Description("Creates a message payload that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.")]
+    public partial class CreateThresholdSlopeSamplesPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO7 pin.")]
-        public LoadCellChannel DO7TargetLoadCell { get; set; }
+        [Description("Slope samples of DO1.")]
+        public byte Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO7TargetLoadCell register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Slope samples of DO2.")]
+        public byte Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Slope samples of DO3.")]
+        public byte Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Slope samples of DO4.")]
+        public byte Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Slope samples of DO5.")]
+        public byte Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Slope samples of DO6.")]
+        public byte Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Slope samples of DO7.")]
+        public byte Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Slope samples of DO8.")]
+        public byte Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ThresholdSlopeSamples register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
-        {
-            return DO7TargetLoadCell;
+        public ThresholdSlopeSamplesPayload GetPayload()
+        {
+            ThresholdSlopeSamplesPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+        /// Creates a message that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO7TargetLoadCell register.</returns>
+        /// <returns>A new message for the ThresholdSlopeSamples register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO7TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdSlopeSamples.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+    /// that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.
     /// </summary>
-    [DisplayName("TimestampedDO7TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO7 pin.")]
-    public partial class CreateTimestampedDO7TargetLoadCellPayload : CreateDO7TargetLoadCellPayload
+    [DisplayName("TimestampedThresholdSlopeSamplesPayload")]
+    [Description("Creates a timestamped message payload that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.")]
+    public partial class CreateTimestampedThresholdSlopeSamplesPayload : CreateThresholdSlopeSamplesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO7 pin.
+        /// Creates a timestamped message that number of samples, from 1 to 16, over which the Slope comparator of each digital output measures the change of its input. The samples are those the thresholds are evaluated on, so it depends on ThresholdsMode and Decimation.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO7TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the ThresholdSlopeSamples register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO7TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdSlopeSamples.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+    /// that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.
     /// </summary>
-    [DisplayName("DO8TargetLoadCellPayload")]
-    [Description("Creates a message payload that target Load Cell that will be used to trigger a threshold event on DO8 pin.")]
-    public partial class CreateDO8TargetLoadCellPayload
+    [DisplayName("ThresholdLogicPayload")]
+    [Description("Creates a message payload that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.")]
+    public partial class CreateThresholdLogicPayload
     {
         /// <summary>
-        /// Gets or sets the value that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that target Load Cell that will be used to trigger a threshold event on DO8 pin.")]
-        public LoadCellChannel DO8TargetLoadCell { get; set; }
+        [Description("Logic of DO1.")]
+        public byte Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO8TargetLoadCell register.
+        /// Gets or sets a value to write on payload member Output2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public LoadCellChannel GetPayload()
-        {
-            return DO8TargetLoadCell;
+        [Description("Logic of DO2.")]
+        public byte Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Logic of DO3.")]
+        public byte Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Logic of DO4.")]
+        public byte Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Logic of DO5.")]
+        public byte Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Logic of DO6.")]
+        public byte Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Logic of DO7.")]
+        public byte Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Logic of DO8.")]
+        public byte Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ThresholdLogic register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ThresholdLogicPayload GetPayload()
+        {
+            ThresholdLogicPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+        /// Creates a message that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO8TargetLoadCell register.</returns>
+        /// <returns>A new message for the ThresholdLogic register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO8TargetLoadCell.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdLogic.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+    /// that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.
     /// </summary>
-    [DisplayName("TimestampedDO8TargetLoadCellPayload")]
-    [Description("Creates a timestamped message payload that target Load Cell that will be used to trigger a threshold event on DO8 pin.")]
-    public partial class CreateTimestampedDO8TargetLoadCellPayload : CreateDO8TargetLoadCellPayload
+    [DisplayName("TimestampedThresholdLogicPayload")]
+    [Description("Creates a timestamped message payload that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.")]
+    public partial class CreateTimestampedThresholdLogicPayload : CreateThresholdLogicPayload
     {
         /// <summary>
-        /// Creates a timestamped message that target Load Cell that will be used to trigger a threshold event on DO8 pin.
+        /// Creates a timestamped message that specifies what drives each digital output. Comparator (0) follows its own comparator, And (1), Or (2) and Xor (3) combine the comparators selected in ThresholdLogicInputs, and Disabled (4) only evaluates the comparator as an input of other outputs. The combined result goes through the output's up and down times.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO8TargetLoadCell register.</returns>
+        /// <returns>A new timestamped message for the ThresholdLogic register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO8TargetLoadCell.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdLogic.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO1 pin.
+    /// that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.
     /// </summary>
-    [DisplayName("DO1ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO1 pin.")]
-    public partial class CreateDO1ThresholdPayload
+    [DisplayName("ThresholdLogicInputsPayload")]
+    [Description("Creates a message payload that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.")]
+    public partial class CreateThresholdLogicInputsPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO1 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO1 pin.")]
-        public short DO1Threshold { get; set; }
+        [Description("Logic inputs of DO1.")]
+        public byte Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1Threshold register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Logic inputs of DO2.")]
+        public byte Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Logic inputs of DO3.")]
+        public byte Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Logic inputs of DO4.")]
+        public byte Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Logic inputs of DO5.")]
+        public byte Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Logic inputs of DO6.")]
+        public byte Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Logic inputs of DO7.")]
+        public byte Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Logic inputs of DO8.")]
+        public byte Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ThresholdLogicInputs register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
-        {
-            return DO1Threshold;
+        public ThresholdLogicInputsPayload GetPayload()
+        {
+            ThresholdLogicInputsPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO1 pin.
+        /// Creates a message that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1Threshold register.</returns>
+        /// <returns>A new message for the ThresholdLogicInputs register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO1Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.ThresholdLogicInputs.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO1 pin.
+    /// that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.
     /// </summary>
-    [DisplayName("TimestampedDO1ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO1 pin.")]
-    public partial class CreateTimestampedDO1ThresholdPayload : CreateDO1ThresholdPayload
+    [DisplayName("TimestampedThresholdLogicInputsPayload")]
+    [Description("Creates a timestamped message payload that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.")]
+    public partial class CreateTimestampedThresholdLogicInputsPayload : CreateThresholdLogicInputsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO1 pin.
+        /// Creates a timestamped message that comparators combined by the logic of each digital output. Bit 0 is the comparator of DO1, bit 1 that of DO2, and so on. The outputs whose DOxTargetLoadCell is None have no comparator of their own, but can still be driven by the logic.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1Threshold register.</returns>
+        /// <returns>A new timestamped message for the ThresholdLogicInputs register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO1Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.ThresholdLogicInputs.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO2 pin.
+    /// that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.
     /// </summary>
-    [DisplayName("DO2ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO2 pin.")]
-    public partial class CreateDO2ThresholdPayload
+    [DisplayName("PulseWidthPayload")]
+    [Description("Creates a message payload that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.")]
+    public partial class CreatePulseWidthPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO2 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO2 pin.")]
-        public short DO2Threshold { get; set; }
+        [Description("Pulse width of DO1.")]
+        public ushort Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO2Threshold register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Pulse width of DO2.")]
+        public ushort Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Pulse width of DO3.")]
+        public ushort Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Pulse width of DO4.")]
+        public ushort Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Pulse width of DO5.")]
+        public ushort Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Pulse width of DO6.")]
+        public ushort Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Pulse width of DO7.")]
+        public ushort Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Pulse width of DO8.")]
+        public ushort Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseWidth register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
-        {
-            return DO2Threshold;
+        public PulseWidthPayload GetPayload()
+        {
+            PulseWidthPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO2 pin.
+        /// Creates a message that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2Threshold register.</returns>
+        /// <returns>A new message for the PulseWidth register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO2Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.PulseWidth.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO2 pin.
+    /// that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.
     /// </summary>
-    [DisplayName("TimestampedDO2ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO2 pin.")]
-    public partial class CreateTimestampedDO2ThresholdPayload : CreateDO2ThresholdPayload
+    [DisplayName("TimestampedPulseWidthPayload")]
+    [Description("Creates a timestamped message payload that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.")]
+    public partial class CreateTimestampedPulseWidthPayload : CreatePulseWidthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO2 pin.
+        /// Creates a timestamped message that width, in milliseconds, of the pulses each digital output fires when its threshold is crossed. Zero makes the output follow the threshold.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2Threshold register.</returns>
+        /// <returns>A new timestamped message for the PulseWidth register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO2Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.PulseWidth.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO3 pin.
+    /// that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.
     /// </summary>
-    [DisplayName("DO3ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO3 pin.")]
-    public partial class CreateDO3ThresholdPayload
+    [DisplayName("PulsePeriodPayload")]
+    [Description("Creates a message payload that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.")]
+    public partial class CreatePulsePeriodPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO3 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO3 pin.")]
-        public short DO3Threshold { get; set; }
+        [Description("Pulse period of DO1.")]
+        public ushort Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO3Threshold register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Pulse period of DO2.")]
+        public ushort Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Pulse period of DO3.")]
+        public ushort Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Pulse period of DO4.")]
+        public ushort Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Pulse period of DO5.")]
+        public ushort Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Pulse period of DO6.")]
+        public ushort Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Pulse period of DO7.")]
+        public ushort Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Pulse period of DO8.")]
+        public ushort Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulsePeriod register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
-        {
-            return DO3Threshold;
+        public PulsePeriodPayload GetPayload()
+        {
+            PulsePeriodPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO3 pin.
+        /// Creates a message that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3Threshold register.</returns>
+        /// <returns>A new message for the PulsePeriod register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO3Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.PulsePeriod.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO3 pin.
+    /// that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.
     /// </summary>
-    [DisplayName("TimestampedDO3ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO3 pin.")]
-    public partial class CreateTimestampedDO3ThresholdPayload : CreateDO3ThresholdPayload
+    [DisplayName("TimestampedPulsePeriodPayload")]
+    [Description("Creates a timestamped message payload that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.")]
+    public partial class CreateTimestampedPulsePeriodPayload : CreatePulsePeriodPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO3 pin.
+        /// Creates a timestamped message that period, in milliseconds, of the pulses of a train. Periods not longer than the width leave the output low for 1 ms between pulses.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3Threshold register.</returns>
+        /// <returns>A new timestamped message for the PulsePeriod register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO3Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.PulsePeriod.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO4 pin.
+    /// that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.
     /// </summary>
-    [DisplayName("DO4ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO4 pin.")]
-    public partial class CreateDO4ThresholdPayload
+    [DisplayName("PulseCountPayload")]
+    [Description("Creates a message payload that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.")]
+    public partial class CreatePulseCountPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO4 pin.
+        /// Gets or sets a value to write on payload member Output1.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO4 pin.")]
-        public short DO4Threshold { get; set; }
+        [Description("Pulse count of DO1.")]
+        public byte Output1 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO4Threshold register.
+        /// Gets or sets a value to write on payload member Output2.
+        /// </summary>
+        [Description("Pulse count of DO2.")]
+        public byte Output2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output3.
+        /// </summary>
+        [Description("Pulse count of DO3.")]
+        public byte Output3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output4.
+        /// </summary>
+        [Description("Pulse count of DO4.")]
+        public byte Output4 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output5.
+        /// </summary>
+        [Description("Pulse count of DO5.")]
+        public byte Output5 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output6.
+        /// </summary>
+        [Description("Pulse count of DO6.")]
+        public byte Output6 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output7.
+        /// </summary>
+        [Description("Pulse count of DO7.")]
+        public byte Output7 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Output8.
+        /// </summary>
+        [Description("Pulse count of DO8.")]
+        public byte Output8 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseCount register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
-        {
-            return DO4Threshold;
+        public PulseCountPayload GetPayload()
+        {
+            PulseCountPayload value;
+            value.Output1 = Output1;
+            value.Output2 = Output2;
+            value.Output3 = Output3;
+            value.Output4 = Output4;
+            value.Output5 = Output5;
+            value.Output6 = Output6;
+            value.Output7 = Output7;
+            value.Output8 = Output8;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO4 pin.
+        /// Creates a message that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO4Threshold register.</returns>
+        /// <returns>A new message for the PulseCount register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO4Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.PulseCount.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO4 pin.
+    /// that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.
     /// </summary>
-    [DisplayName("TimestampedDO4ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO4 pin.")]
-    public partial class CreateTimestampedDO4ThresholdPayload : CreateDO4ThresholdPayload
+    [DisplayName("TimestampedPulseCountPayload")]
+    [Description("Creates a timestamped message payload that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.")]
+    public partial class CreateTimestampedPulseCountPayload : CreatePulseCountPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO4 pin.
+        /// Creates a timestamped message that number of pulses, from 1 to 255, each digital output fires when its threshold is crossed. Crossings during a train are ignored.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO4Threshold register.</returns>
+        /// <returns>A new timestamped message for the PulseCount register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO4Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.PulseCount.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO5 pin.
+    /// that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.
     /// </summary>
-    [DisplayName("DO5ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO5 pin.")]
-    public partial class CreateDO5ThresholdPayload
+    [DisplayName("DoSchedulePayload")]
+    [Description("Creates a message payload that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.")]
+    public partial class CreateDoSchedulePayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO5 pin.
+        /// Gets or sets the value that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO5 pin.")]
-        public short DO5Threshold { get; set; }
+        [Description("The value that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.")]
+        public uint[] DoSchedule { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO5Threshold register.
+        /// Creates a message payload for the DoSchedule register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public uint[] GetPayload()
         {
-            return DO5Threshold;
+            return DoSchedule;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO5 pin.
+        /// Creates a message that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO5Threshold register.</returns>
+        /// <returns>A new message for the DoSchedule register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO5Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DoSchedule.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO5 pin.
+    /// that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.
     /// </summary>
-    [DisplayName("TimestampedDO5ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO5 pin.")]
-    public partial class CreateTimestampedDO5ThresholdPayload : CreateDO5ThresholdPayload
+    [DisplayName("TimestampedDoSchedulePayload")]
+    [Description("Creates a timestamped message payload that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.")]
+    public partial class CreateTimestampedDoSchedulePayload : CreateDoSchedulePayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO5 pin.
+        /// Creates a timestamped message that up to 30 entries of the digital output schedule, each as a pair of words. The first is the delay in microseconds from the previous entry, up to 100 s, the second is the action (0 Set, 1 Clear, 2 Toggle) shifted left by 16 bits and ORed with the outputs, as in DigitalOutputState. Entries are never played early. An entry due while the one before is still being played, a few microseconds or longer during a load cell readout, is played late right after it and counted in ScheduleEntriesMerged.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO5Threshold register.</returns>
+        /// <returns>A new timestamped message for the DoSchedule register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO5Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DoSchedule.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO6 pin.
+    /// that number of entries of DoSchedule that are played, from 0 to 30.
     /// </summary>
-    [DisplayName("DO6ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO6 pin.")]
-    public partial class CreateDO6ThresholdPayload
+    [DisplayName("DoScheduleLengthPayload")]
+    [Description("Creates a message payload that number of entries of DoSchedule that are played, from 0 to 30.")]
+    public partial class CreateDoScheduleLengthPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO6 pin.
+        /// Gets or sets the value that number of entries of DoSchedule that are played, from 0 to 30.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO6 pin.")]
-        public short DO6Threshold { get; set; }
+        [Description("The value that number of entries of DoSchedule that are played, from 0 to 30.")]
+        public byte DoScheduleLength { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO6Threshold register.
+        /// Creates a message payload for the DoScheduleLength register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public byte GetPayload()
         {
-            return DO6Threshold;
+            return DoScheduleLength;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO6 pin.
+        /// Creates a message that number of entries of DoSchedule that are played, from 0 to 30.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO6Threshold register.</returns>
+        /// <returns>A new message for the DoScheduleLength register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO6Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DoScheduleLength.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO6 pin.
+    /// that number of entries of DoSchedule that are played, from 0 to 30.
     /// </summary>
-    [DisplayName("TimestampedDO6ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO6 pin.")]
-    public partial class CreateTimestampedDO6ThresholdPayload : CreateDO6ThresholdPayload
+    [DisplayName("TimestampedDoScheduleLengthPayload")]
+    [Description("Creates a timestamped message payload that number of entries of DoSchedule that are played, from 0 to 30.")]
+    public partial class CreateTimestampedDoScheduleLengthPayload : CreateDoScheduleLengthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO6 pin.
+        /// Creates a timestamped message that number of entries of DoSchedule that are played, from 0 to 30.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO6Threshold register.</returns>
+        /// <returns>A new timestamped message for the DoScheduleLength register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO6Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DoScheduleLength.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO7 pin.
+    /// that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.
     /// </summary>
-    [DisplayName("DO7ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO7 pin.")]
-    public partial class CreateDO7ThresholdPayload
+    [DisplayName("DoScheduleStartTimePayload")]
+    [Description("Creates a message payload that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.")]
+    public partial class CreateDoScheduleStartTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO7 pin.
+        /// Gets or sets a value to write on payload member Seconds.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO7 pin.")]
-        public short DO7Threshold { get; set; }
+        [Description("Seconds of the start time.")]
+        public uint Seconds { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO7Threshold register.
+        /// Gets or sets a value to write on payload member Microseconds.
+        /// </summary>
+        [Description("Microseconds of the start time, from 0 to 999999.")]
+        public uint Microseconds { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DoScheduleStartTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public DoScheduleStartTimePayload GetPayload()
         {
-            return DO7Threshold;
+            DoScheduleStartTimePayload value;
+            value.Seconds = Seconds;
+            value.Microseconds = Microseconds;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO7 pin.
+        /// Creates a message that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO7Threshold register.</returns>
+        /// <returns>A new message for the DoScheduleStartTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO7Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DoScheduleStartTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO7 pin.
+    /// that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.
     /// </summary>
-    [DisplayName("TimestampedDO7ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO7 pin.")]
-    public partial class CreateTimestampedDO7ThresholdPayload : CreateDO7ThresholdPayload
+    [DisplayName("TimestampedDoScheduleStartTimePayload")]
+    [Description("Creates a timestamped message payload that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.")]
+    public partial class CreateTimestampedDoScheduleStartTimePayload : CreateDoScheduleStartTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO7 pin.
+        /// Creates a timestamped message that harp time to start the schedule at when DoScheduleStart is AtTime. The start is resolved to 32 us.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO7Threshold register.</returns>
+        /// <returns>A new timestamped message for the DoScheduleStartTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO7Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DoScheduleStartTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that value used to threshold a Load Cell read, and trigger DO8 pin.
-    /// </summary>
-    [DisplayName("DO8ThresholdPayload")]
-    [Description("Creates a message payload that value used to threshold a Load Cell read, and trigger DO8 pin.")]
-    public partial class CreateDO8ThresholdPayload
+    /// Represents an operator that creates a message payload
+    /// that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.
+    /// </summary>
+    [DisplayName("DoScheduleStartPayload")]
+    [Description("Creates a message payload that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.")]
+    public partial class CreateDoScheduleStartPayload
     {
         /// <summary>
-        /// Gets or sets the value that value used to threshold a Load Cell read, and trigger DO8 pin.
+        /// Gets or sets the value that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.
         /// </summary>
-        [Description("The value that value used to threshold a Load Cell read, and trigger DO8 pin.")]
-        public short DO8Threshold { get; set; }
+        [Description("The value that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.")]
+        public ScheduleStartConfig DoScheduleStart { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO8Threshold register.
+        /// Creates a message payload for the DoScheduleStart register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public short GetPayload()
+        public ScheduleStartConfig GetPayload()
         {
-            return DO8Threshold;
+            return DoScheduleStart;
         }
 
         /// <summary>
-        /// Creates a message that value used to threshold a Load Cell read, and trigger DO8 pin.
+        /// Creates a message that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO8Threshold register.</returns>
+        /// <returns>A new message for the DoScheduleStart register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO8Threshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DoScheduleStart.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value used to threshold a Load Cell read, and trigger DO8 pin.
+    /// that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.
     /// </summary>
-    [DisplayName("TimestampedDO8ThresholdPayload")]
-    [Description("Creates a timestamped message payload that value used to threshold a Load Cell read, and trigger DO8 pin.")]
-    public partial class CreateTimestampedDO8ThresholdPayload : CreateDO8ThresholdPayload
+    [DisplayName("TimestampedDoScheduleStartPayload")]
+    [Description("Creates a timestamped message payload that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.")]
+    public partial class CreateTimestampedDoScheduleStartPayload : CreateDoScheduleStartPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value used to threshold a Load Cell read, and trigger DO8 pin.
+        /// Creates a timestamped message that starts or stops the digital output schedule. Reads as Stop once the schedule ends, which sends an event.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO8Threshold register.</returns>
+        /// <returns>A new timestamped message for the DoScheduleStart register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO8Threshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DoScheduleStart.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.
     /// </summary>
-    [DisplayName("DO1TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateDO1TimeAboveThresholdPayload
+    [DisplayName("DigitalInputEdgePayload")]
+    [Description("Creates a message payload that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.")]
+    public partial class CreateDigitalInputEdgePayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// Gets or sets a value to write on payload member State.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-        public ushort DO1TimeAboveThreshold { get; set; } = 0;
+        [Description("State of the input after the edge.")]
+        public ushort State { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1TimeAboveThreshold register.
+        /// Gets or sets a value to write on payload member Capture.
+        /// </summary>
+        [Description("Timer count at the edge, in steps of 0.25 us. It wraps every 16.384 ms, so the difference between two edges is exact to 0.25 us when they are closer than that.")]
+        public ushort Capture { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputEdge register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public DigitalInputEdgePayload GetPayload()
         {
-            return DO1TimeAboveThreshold;
+            DigitalInputEdgePayload value;
+            value.State = State;
+            value.Capture = Capture;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// Creates a message that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1TimeAboveThreshold register.</returns>
+        /// <returns>A new message for the DigitalInputEdge register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.LoadCells.DO1TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return Harp.LoadCells.DigitalInputEdge.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO1 pin event.
+    /// that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.
     /// </summary>
-    [DisplayName("TimestampedDO1TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateTimestampedDO1TimeAboveThresholdPayload : CreateDO1TimeAboveThresholdPayload
+    [DisplayName("TimestampedDigitalInputEdgePayload")]
+    [Description("Creates a timestamped message payload that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.")]
+    public partial class CreateTimestampedDigitalInputEdgePayload : CreateDigitalInputEdgePayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO1 pin event.
+        /// Creates a timestamped message that edges of the digital input pin 0, captured by a hardware timer. Each edge is sent in order, timestamped with the Harp time of the edge. Enabling this event starts the capture.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1TimeAboveThreshold register.</returns>
+        /// <returns>A new timestamped message for the DigitalInputEdge register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.LoadCells.DO1TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.LoadCells.DigitalInputEdge.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// Represents the payload of the LoadCellData register.
     /// </summary>
-    [DisplayName("DO2TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateDO2TimeAboveThresholdPayload
+    public struct LoadCellDataPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// Initializes a new instance of the <see cref="LoadCellDataPayload"/> structure.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-        public ushort DO2TimeAboveThreshold { get; set; } = 0;
+        /// <param name="channel0"></param>
+        /// <param name="channel1"></param>
+        /// <param name="channel2"></param>
+        /// <param name="channel3"></param>
+        /// <param name="channel4"></param>
+        /// <param name="channel5"></param>
+        /// <param name="channel6"></param>
+        /// <param name="channel7"></param>
+        public LoadCellDataPayload(
+            short channel0,
+            short channel1,
+            short channel2,
+            short channel3,
+            short channel4,
+            short channel5,
+            short channel6,
+            short channel7)
+        {
+            Channel0 = channel0;
+            Channel1 = channel1;
+            Channel2 = channel2;
+            Channel3 = channel3;
+            Channel4 = channel4;
+            Channel5 = channel5;
+            Channel6 = channel6;
+            Channel7 = channel7;
+        }
 
         /// <summary>
-        /// Creates a message payload for the DO2TimeAboveThreshold register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO2TimeAboveThreshold;
-        }
+        public short Channel0;
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// 
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public short Channel1;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel2;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel3;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel4;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel5;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel6;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel7;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the LoadCellData register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// LoadCellData register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO2TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return "LoadCellDataPayload { " +
+                "Channel0 = " + Channel0 + ", " +
+                "Channel1 = " + Channel1 + ", " +
+                "Channel2 = " + Channel2 + ", " +
+                "Channel3 = " + Channel3 + ", " +
+                "Channel4 = " + Channel4 + ", " +
+                "Channel5 = " + Channel5 + ", " +
+                "Channel6 = " + Channel6 + ", " +
+                "Channel7 = " + Channel7 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO2 pin event.
+    /// Represents the payload of the PerformanceCounters register.
     /// </summary>
-    [DisplayName("TimestampedDO2TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateTimestampedDO2TimeAboveThresholdPayload : CreateDO2TimeAboveThresholdPayload
+    public struct PerformanceCountersPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO2 pin event.
+        /// Initializes a new instance of the <see cref="PerformanceCountersPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="samplesAcquired">Samples read from the ADCs.</param>
+        /// <param name="samplesDropped">Conversions lost because the readout of the previous sample was still on going.</param>
+        /// <param name="eventsDropped">Load cell events not sent because the transmit buffer was full.</param>
+        /// <param name="readoutMaxCycles">Longest processing of a sample after its readout, in CPU cycles.</param>
+        /// <param name="thresholdsMaxCycles">Longest evaluation of the thresholds, in CPU cycles.</param>
+        /// <param name="transmitBufferMax">Most bytes waiting in the transmit buffer.</param>
+        /// <param name="digitalInputEdgesDropped">Edges of the digital input pin 0 lost because the capture buffer or the queue was full.</param>
+        /// <param name="scheduleEntriesMerged">Entries of DoSchedule with a delay that were played late, right after the entry before them.</param>
+        public PerformanceCountersPayload(
+            uint samplesAcquired,
+            uint samplesDropped,
+            uint eventsDropped,
+            uint readoutMaxCycles,
+            uint thresholdsMaxCycles,
+            uint transmitBufferMax,
+            uint digitalInputEdgesDropped,
+            uint scheduleEntriesMerged)
         {
-            return Harp.LoadCells.DO2TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            SamplesAcquired = samplesAcquired;
+            SamplesDropped = samplesDropped;
+            EventsDropped = eventsDropped;
+            ReadoutMaxCycles = readoutMaxCycles;
+            ThresholdsMaxCycles = thresholdsMaxCycles;
+            TransmitBufferMax = transmitBufferMax;
+            DigitalInputEdgesDropped = digitalInputEdgesDropped;
+            ScheduleEntriesMerged = scheduleEntriesMerged;
+        }
+
+        /// <summary>
+        /// Samples read from the ADCs.
+        /// </summary>
+        public uint SamplesAcquired;
+
+        /// <summary>
+        /// Conversions lost because the readout of the previous sample was still on going.
+        /// </summary>
+        public uint SamplesDropped;
+
+        /// <summary>
+        /// Load cell events not sent because the transmit buffer was full.
+        /// </summary>
+        public uint EventsDropped;
+
+        /// <summary>
+        /// Longest processing of a sample after its readout, in CPU cycles.
+        /// </summary>
+        public uint ReadoutMaxCycles;
+
+        /// <summary>
+        /// Longest evaluation of the thresholds, in CPU cycles.
+        /// </summary>
+        public uint ThresholdsMaxCycles;
+
+        /// <summary>
+        /// Most bytes waiting in the transmit buffer.
+        /// </summary>
+        public uint TransmitBufferMax;
+
+        /// <summary>
+        /// Edges of the digital input pin 0 lost because the capture buffer or the queue was full.
+        /// </summary>
+        public uint DigitalInputEdgesDropped;
+
+        /// <summary>
+        /// Entries of DoSchedule with a delay that were played late, right after the entry before them.
+        /// </summary>
+        public uint ScheduleEntriesMerged;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PerformanceCounters register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PerformanceCounters register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "PerformanceCountersPayload { " +
+                "SamplesAcquired = " + SamplesAcquired + ", " +
+                "SamplesDropped = " + SamplesDropped + ", " +
+                "EventsDropped = " + EventsDropped + ", " +
+                "ReadoutMaxCycles = " + ReadoutMaxCycles + ", " +
+                "ThresholdsMaxCycles = " + ThresholdsMaxCycles + ", " +
+                "TransmitBufferMax = " + TransmitBufferMax + ", " +
+                "DigitalInputEdgesDropped = " + DigitalInputEdgesDropped + ", " +
+                "ScheduleEntriesMerged = " + ScheduleEntriesMerged + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// Represents the payload of the LoadCellDataVirtual register.
     /// </summary>
-    [DisplayName("DO3TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateDO3TimeAboveThresholdPayload
+    public struct LoadCellDataVirtualPayload
     {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// Initializes a new instance of the <see cref="LoadCellDataVirtualPayload"/> structure.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-        public ushort DO3TimeAboveThreshold { get; set; } = 0;
+        /// <param name="virtual0"></param>
+        /// <param name="virtual1"></param>
+        /// <param name="virtual2"></param>
+        /// <param name="virtual3"></param>
+        public LoadCellDataVirtualPayload(
+            short virtual0,
+            short virtual1,
+            short virtual2,
+            short virtual3)
+        {
+            Virtual0 = virtual0;
+            Virtual1 = virtual1;
+            Virtual2 = virtual2;
+            Virtual3 = virtual3;
+        }
 
         /// <summary>
-        /// Creates a message payload for the DO3TimeAboveThreshold register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public short Virtual0;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Virtual1;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Virtual2;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Virtual3;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the LoadCellDataVirtual register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// LoadCellDataVirtual register.
+        /// </returns>
+        public override string ToString()
         {
-            return DO3TimeAboveThreshold;
+            return "LoadCellDataVirtualPayload { " +
+                "Virtual0 = " + Virtual0 + ", " +
+                "Virtual1 = " + Virtual1 + ", " +
+                "Virtual2 = " + Virtual2 + ", " +
+                "Virtual3 = " + Virtual3 + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the ThresholdComparator register.
+    /// </summary>
+    public struct ThresholdComparatorPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ThresholdComparatorPayload"/> structure.
+        /// </summary>
+        /// <param name="output1">Comparator of DO1.</param>
+        /// <param name="output2">Comparator of DO2.</param>
+        /// <param name="output3">Comparator of DO3.</param>
+        /// <param name="output4">Comparator of DO4.</param>
+        /// <param name="output5">Comparator of DO5.</param>
+        /// <param name="output6">Comparator of DO6.</param>
+        /// <param name="output7">Comparator of DO7.</param>
+        /// <param name="output8">Comparator of DO8.</param>
+        public ThresholdComparatorPayload(
+            byte output1,
+            byte output2,
+            byte output3,
+            byte output4,
+            byte output5,
+            byte output6,
+            byte output7,
+            byte output8)
+        {
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// Comparator of DO1.
+        /// </summary>
+        public byte Output1;
+
+        /// <summary>
+        /// Comparator of DO2.
+        /// </summary>
+        public byte Output2;
+
+        /// <summary>
+        /// Comparator of DO3.
+        /// </summary>
+        public byte Output3;
+
+        /// <summary>
+        /// Comparator of DO4.
+        /// </summary>
+        public byte Output4;
+
+        /// <summary>
+        /// Comparator of DO5.
+        /// </summary>
+        public byte Output5;
+
+        /// <summary>
+        /// Comparator of DO6.
+        /// </summary>
+        public byte Output6;
+
+        /// <summary>
+        /// Comparator of DO7.
+        /// </summary>
+        public byte Output7;
+
+        /// <summary>
+        /// Comparator of DO8.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public byte Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ThresholdComparator register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ThresholdComparator register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO3TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return "ThresholdComparatorPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO3 pin event.
+    /// Represents the payload of the ThresholdLow register.
     /// </summary>
-    [DisplayName("TimestampedDO3TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateTimestampedDO3TimeAboveThresholdPayload : CreateDO3TimeAboveThresholdPayload
+    public struct ThresholdLowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO3 pin event.
+        /// Initializes a new instance of the <see cref="ThresholdLowPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Lower threshold of DO1.</param>
+        /// <param name="output2">Lower threshold of DO2.</param>
+        /// <param name="output3">Lower threshold of DO3.</param>
+        /// <param name="output4">Lower threshold of DO4.</param>
+        /// <param name="output5">Lower threshold of DO5.</param>
+        /// <param name="output6">Lower threshold of DO6.</param>
+        /// <param name="output7">Lower threshold of DO7.</param>
+        /// <param name="output8">Lower threshold of DO8.</param>
+        public ThresholdLowPayload(
+            short output1,
+            short output2,
+            short output3,
+            short output4,
+            short output5,
+            short output6,
+            short output7,
+            short output8)
         {
-            return Harp.LoadCells.DO3TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO4 pin event.
-    /// </summary>
-    [DisplayName("DO4TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO4 pin event.")]
-    public partial class CreateDO4TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO4 pin event.
+        /// Lower threshold of DO1.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO4 pin event.")]
-        public ushort DO4TimeAboveThreshold { get; set; } = 0;
+        public short Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO4TimeAboveThreshold register.
+        /// Lower threshold of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO4TimeAboveThreshold;
-        }
+        public short Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO4 pin event.
+        /// Lower threshold of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO4TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO4TimeAboveThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public short Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO4 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO4TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO4 pin event.")]
-    public partial class CreateTimestampedDO4TimeAboveThresholdPayload : CreateDO4TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO4 pin event.
+        /// Lower threshold of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO4TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO4TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public short Output4;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO5 pin event.
-    /// </summary>
-    [DisplayName("DO5TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO5 pin event.")]
-    public partial class CreateDO5TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO5 pin event.
+        /// Lower threshold of DO5.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO5 pin event.")]
-        public ushort DO5TimeAboveThreshold { get; set; } = 0;
+        public short Output5;
 
         /// <summary>
-        /// Creates a message payload for the DO5TimeAboveThreshold register.
+        /// Lower threshold of DO6.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO5TimeAboveThreshold;
-        }
+        public short Output6;
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO5 pin event.
+        /// Lower threshold of DO7.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO5TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public short Output7;
+
+        /// <summary>
+        /// Lower threshold of DO8.
+        /// </summary>
+        public short Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ThresholdLow register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ThresholdLow register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO5TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return "ThresholdLowPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO5 pin event.
+    /// Represents the payload of the ThresholdSlopeSamples register.
     /// </summary>
-    [DisplayName("TimestampedDO5TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO5 pin event.")]
-    public partial class CreateTimestampedDO5TimeAboveThresholdPayload : CreateDO5TimeAboveThresholdPayload
+    public struct ThresholdSlopeSamplesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO5 pin event.
+        /// Initializes a new instance of the <see cref="ThresholdSlopeSamplesPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO5TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Slope samples of DO1.</param>
+        /// <param name="output2">Slope samples of DO2.</param>
+        /// <param name="output3">Slope samples of DO3.</param>
+        /// <param name="output4">Slope samples of DO4.</param>
+        /// <param name="output5">Slope samples of DO5.</param>
+        /// <param name="output6">Slope samples of DO6.</param>
+        /// <param name="output7">Slope samples of DO7.</param>
+        /// <param name="output8">Slope samples of DO8.</param>
+        public ThresholdSlopeSamplesPayload(
+            byte output1,
+            byte output2,
+            byte output3,
+            byte output4,
+            byte output5,
+            byte output6,
+            byte output7,
+            byte output8)
         {
-            return Harp.LoadCells.DO5TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO6 pin event.
-    /// </summary>
-    [DisplayName("DO6TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO6 pin event.")]
-    public partial class CreateDO6TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO6 pin event.
+        /// Slope samples of DO1.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO6 pin event.")]
-        public ushort DO6TimeAboveThreshold { get; set; } = 0;
+        public byte Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO6TimeAboveThreshold register.
+        /// Slope samples of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO6TimeAboveThreshold;
-        }
+        public byte Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO6 pin event.
+        /// Slope samples of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO6TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO6TimeAboveThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public byte Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO6 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO6TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO6 pin event.")]
-    public partial class CreateTimestampedDO6TimeAboveThresholdPayload : CreateDO6TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO6 pin event.
+        /// Slope samples of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO6TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO6TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public byte Output4;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO7 pin event.
-    /// </summary>
-    [DisplayName("DO7TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO7 pin event.")]
-    public partial class CreateDO7TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO7 pin event.
+        /// Slope samples of DO5.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO7 pin event.")]
-        public ushort DO7TimeAboveThreshold { get; set; } = 0;
+        public byte Output5;
 
         /// <summary>
-        /// Creates a message payload for the DO7TimeAboveThreshold register.
+        /// Slope samples of DO6.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO7TimeAboveThreshold;
-        }
+        public byte Output6;
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO7 pin event.
+        /// Slope samples of DO7.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO7TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public byte Output7;
+
+        /// <summary>
+        /// Slope samples of DO8.
+        /// </summary>
+        public byte Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ThresholdSlopeSamples register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ThresholdSlopeSamples register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO7TimeAboveThreshold.FromPayload(messageType, GetPayload());
+            return "ThresholdSlopeSamplesPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO7 pin event.
+    /// Represents the payload of the ThresholdLogic register.
     /// </summary>
-    [DisplayName("TimestampedDO7TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO7 pin event.")]
-    public partial class CreateTimestampedDO7TimeAboveThresholdPayload : CreateDO7TimeAboveThresholdPayload
+    public struct ThresholdLogicPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO7 pin event.
+        /// Initializes a new instance of the <see cref="ThresholdLogicPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO7TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Logic of DO1.</param>
+        /// <param name="output2">Logic of DO2.</param>
+        /// <param name="output3">Logic of DO3.</param>
+        /// <param name="output4">Logic of DO4.</param>
+        /// <param name="output5">Logic of DO5.</param>
+        /// <param name="output6">Logic of DO6.</param>
+        /// <param name="output7">Logic of DO7.</param>
+        /// <param name="output8">Logic of DO8.</param>
+        public ThresholdLogicPayload(
+            byte output1,
+            byte output2,
+            byte output3,
+            byte output4,
+            byte output5,
+            byte output6,
+            byte output7,
+            byte output8)
         {
-            return Harp.LoadCells.DO7TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) above threshold value that is required to trigger a DO8 pin event.
-    /// </summary>
-    [DisplayName("DO8TimeAboveThresholdPayload")]
-    [Description("Creates a message payload that time (ms) above threshold value that is required to trigger a DO8 pin event.")]
-    public partial class CreateDO8TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) above threshold value that is required to trigger a DO8 pin event.
+        /// Logic of DO1.
         /// </summary>
-        [Description("The value that time (ms) above threshold value that is required to trigger a DO8 pin event.")]
-        public ushort DO8TimeAboveThreshold { get; set; } = 0;
+        public byte Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO8TimeAboveThreshold register.
+        /// Logic of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO8TimeAboveThreshold;
-        }
+        public byte Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) above threshold value that is required to trigger a DO8 pin event.
+        /// Logic of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO8TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO8TimeAboveThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public byte Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) above threshold value that is required to trigger a DO8 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO8TimeAboveThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) above threshold value that is required to trigger a DO8 pin event.")]
-    public partial class CreateTimestampedDO8TimeAboveThresholdPayload : CreateDO8TimeAboveThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) above threshold value that is required to trigger a DO8 pin event.
+        /// Logic of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO8TimeAboveThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO8TimeAboveThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public byte Output4;
+
+        /// <summary>
+        /// Logic of DO5.
+        /// </summary>
+        public byte Output5;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
-    /// </summary>
-    [DisplayName("DO1TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateDO1TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// Logic of DO6.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-        public ushort DO1TimeBelowThreshold { get; set; } = 0;
+        public byte Output6;
 
         /// <summary>
-        /// Creates a message payload for the DO1TimeBelowThreshold register.
+        /// Logic of DO7.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO1TimeBelowThreshold;
-        }
+        public byte Output7;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// Logic of DO8.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public byte Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ThresholdLogic register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ThresholdLogic register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO1TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return "ThresholdLogicPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO1 pin event.
+    /// Represents the payload of the ThresholdLogicInputs register.
     /// </summary>
-    [DisplayName("TimestampedDO1TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO1 pin event.")]
-    public partial class CreateTimestampedDO1TimeBelowThresholdPayload : CreateDO1TimeBelowThresholdPayload
+    public struct ThresholdLogicInputsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO1 pin event.
+        /// Initializes a new instance of the <see cref="ThresholdLogicInputsPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Logic inputs of DO1.</param>
+        /// <param name="output2">Logic inputs of DO2.</param>
+        /// <param name="output3">Logic inputs of DO3.</param>
+        /// <param name="output4">Logic inputs of DO4.</param>
+        /// <param name="output5">Logic inputs of DO5.</param>
+        /// <param name="output6">Logic inputs of DO6.</param>
+        /// <param name="output7">Logic inputs of DO7.</param>
+        /// <param name="output8">Logic inputs of DO8.</param>
+        public ThresholdLogicInputsPayload(
+            byte output1,
+            byte output2,
+            byte output3,
+            byte output4,
+            byte output5,
+            byte output6,
+            byte output7,
+            byte output8)
         {
-            return Harp.LoadCells.DO1TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
-    /// </summary>
-    [DisplayName("DO2TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateDO2TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// Logic inputs of DO1.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-        public ushort DO2TimeBelowThreshold { get; set; } = 0;
+        public byte Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO2TimeBelowThreshold register.
+        /// Logic inputs of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO2TimeBelowThreshold;
-        }
+        public byte Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// Logic inputs of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO2TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO2TimeBelowThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public byte Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO2 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO2TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO2 pin event.")]
-    public partial class CreateTimestampedDO2TimeBelowThresholdPayload : CreateDO2TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO2 pin event.
+        /// Logic inputs of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO2TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO2TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public byte Output4;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
-    /// </summary>
-    [DisplayName("DO3TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateDO3TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// Logic inputs of DO5.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-        public ushort DO3TimeBelowThreshold { get; set; } = 0;
+        public byte Output5;
 
         /// <summary>
-        /// Creates a message payload for the DO3TimeBelowThreshold register.
+        /// Logic inputs of DO6.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO3TimeBelowThreshold;
-        }
+        public byte Output6;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// Logic inputs of DO7.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO3TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public byte Output7;
+
+        /// <summary>
+        /// Logic inputs of DO8.
+        /// </summary>
+        public byte Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ThresholdLogicInputs register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ThresholdLogicInputs register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO3TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return "ThresholdLogicInputsPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO3 pin event.
+    /// Represents the payload of the PulseWidth register.
     /// </summary>
-    [DisplayName("TimestampedDO3TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO3 pin event.")]
-    public partial class CreateTimestampedDO3TimeBelowThresholdPayload : CreateDO3TimeBelowThresholdPayload
+    public struct PulseWidthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO3 pin event.
+        /// Initializes a new instance of the <see cref="PulseWidthPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO3TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Pulse width of DO1.</param>
+        /// <param name="output2">Pulse width of DO2.</param>
+        /// <param name="output3">Pulse width of DO3.</param>
+        /// <param name="output4">Pulse width of DO4.</param>
+        /// <param name="output5">Pulse width of DO5.</param>
+        /// <param name="output6">Pulse width of DO6.</param>
+        /// <param name="output7">Pulse width of DO7.</param>
+        /// <param name="output8">Pulse width of DO8.</param>
+        public PulseWidthPayload(
+            ushort output1,
+            ushort output2,
+            ushort output3,
+            ushort output4,
+            ushort output5,
+            ushort output6,
+            ushort output7,
+            ushort output8)
         {
-            return Harp.LoadCells.DO3TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO4 pin event.
-    /// </summary>
-    [DisplayName("DO4TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO4 pin event.")]
-    public partial class CreateDO4TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO4 pin event.
+        /// Pulse width of DO1.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO4 pin event.")]
-        public ushort DO4TimeBelowThreshold { get; set; } = 0;
+        public ushort Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO4TimeBelowThreshold register.
+        /// Pulse width of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO4TimeBelowThreshold;
-        }
+        public ushort Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO4 pin event.
+        /// Pulse width of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO4TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO4TimeBelowThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public ushort Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO4 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO4TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO4 pin event.")]
-    public partial class CreateTimestampedDO4TimeBelowThresholdPayload : CreateDO4TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO4 pin event.
+        /// Pulse width of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO4TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO4TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public ushort Output4;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO5 pin event.
-    /// </summary>
-    [DisplayName("DO5TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO5 pin event.")]
-    public partial class CreateDO5TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO5 pin event.
+        /// Pulse width of DO5.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO5 pin event.")]
-        public ushort DO5TimeBelowThreshold { get; set; } = 0;
+        public ushort Output5;
 
         /// <summary>
-        /// Creates a message payload for the DO5TimeBelowThreshold register.
+        /// Pulse width of DO6.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO5TimeBelowThreshold;
-        }
+        public ushort Output6;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO5 pin event.
+        /// Pulse width of DO7.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO5TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort Output7;
+
+        /// <summary>
+        /// Pulse width of DO8.
+        /// </summary>
+        public ushort Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PulseWidth register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PulseWidth register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO5TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return "PulseWidthPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO5 pin event.
+    /// Represents the payload of the PulsePeriod register.
     /// </summary>
-    [DisplayName("TimestampedDO5TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO5 pin event.")]
-    public partial class CreateTimestampedDO5TimeBelowThresholdPayload : CreateDO5TimeBelowThresholdPayload
+    public struct PulsePeriodPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO5 pin event.
+        /// Initializes a new instance of the <see cref="PulsePeriodPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO5TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Pulse period of DO1.</param>
+        /// <param name="output2">Pulse period of DO2.</param>
+        /// <param name="output3">Pulse period of DO3.</param>
+        /// <param name="output4">Pulse period of DO4.</param>
+        /// <param name="output5">Pulse period of DO5.</param>
+        /// <param name="output6">Pulse period of DO6.</param>
+        /// <param name="output7">Pulse period of DO7.</param>
+        /// <param name="output8">Pulse period of DO8.</param>
+        public PulsePeriodPayload(
+            ushort output1,
+            ushort output2,
+            ushort output3,
+            ushort output4,
+            ushort output5,
+            ushort output6,
+            ushort output7,
+            ushort output8)
         {
-            return Harp.LoadCells.DO5TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO6 pin event.
-    /// </summary>
-    [DisplayName("DO6TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO6 pin event.")]
-    public partial class CreateDO6TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO6 pin event.
+        /// Pulse period of DO1.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO6 pin event.")]
-        public ushort DO6TimeBelowThreshold { get; set; } = 0;
+        public ushort Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO6TimeBelowThreshold register.
+        /// Pulse period of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO6TimeBelowThreshold;
-        }
+        public ushort Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO6 pin event.
+        /// Pulse period of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO6TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO6TimeBelowThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public ushort Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO6 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO6TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO6 pin event.")]
-    public partial class CreateTimestampedDO6TimeBelowThresholdPayload : CreateDO6TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO6 pin event.
+        /// Pulse period of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO6TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO6TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public ushort Output4;
+
+        /// <summary>
+        /// Pulse period of DO5.
+        /// </summary>
+        public ushort Output5;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO7 pin event.
-    /// </summary>
-    [DisplayName("DO7TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO7 pin event.")]
-    public partial class CreateDO7TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO7 pin event.
+        /// Pulse period of DO6.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO7 pin event.")]
-        public ushort DO7TimeBelowThreshold { get; set; } = 0;
+        public ushort Output6;
 
         /// <summary>
-        /// Creates a message payload for the DO7TimeBelowThreshold register.
+        /// Pulse period of DO7.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO7TimeBelowThreshold;
-        }
+        public ushort Output7;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO7 pin event.
+        /// Pulse period of DO8.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO7TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PulsePeriod register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PulsePeriod register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.DO7TimeBelowThreshold.FromPayload(messageType, GetPayload());
+            return "PulsePeriodPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO7 pin event.
+    /// Represents the payload of the PulseCount register.
     /// </summary>
-    [DisplayName("TimestampedDO7TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO7 pin event.")]
-    public partial class CreateTimestampedDO7TimeBelowThresholdPayload : CreateDO7TimeBelowThresholdPayload
+    public struct PulseCountPayload
     {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO7 pin event.
+        /// Initializes a new instance of the <see cref="PulseCountPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO7TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="output1">Pulse count of DO1.</param>
+        /// <param name="output2">Pulse count of DO2.</param>
+        /// <param name="output3">Pulse count of DO3.</param>
+        /// <param name="output4">Pulse count of DO4.</param>
+        /// <param name="output5">Pulse count of DO5.</param>
+        /// <param name="output6">Pulse count of DO6.</param>
+        /// <param name="output7">Pulse count of DO7.</param>
+        /// <param name="output8">Pulse count of DO8.</param>
+        public PulseCountPayload(
+            byte output1,
+            byte output2,
+            byte output3,
+            byte output4,
+            byte output5,
+            byte output6,
+            byte output7,
+            byte output8)
         {
-            return Harp.LoadCells.DO7TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
+            Output1 = output1;
+            Output2 = output2;
+            Output3 = output3;
+            Output4 = output4;
+            Output5 = output5;
+            Output6 = output6;
+            Output7 = output7;
+            Output8 = output8;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that time (ms) below threshold value that is required to trigger a DO8 pin event.
-    /// </summary>
-    [DisplayName("DO8TimeBelowThresholdPayload")]
-    [Description("Creates a message payload that time (ms) below threshold value that is required to trigger a DO8 pin event.")]
-    public partial class CreateDO8TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Gets or sets the value that time (ms) below threshold value that is required to trigger a DO8 pin event.
+        /// Pulse count of DO1.
         /// </summary>
-        [Description("The value that time (ms) below threshold value that is required to trigger a DO8 pin event.")]
-        public ushort DO8TimeBelowThreshold { get; set; } = 0;
+        public byte Output1;
 
         /// <summary>
-        /// Creates a message payload for the DO8TimeBelowThreshold register.
+        /// Pulse count of DO2.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
-        {
-            return DO8TimeBelowThreshold;
-        }
+        public byte Output2;
 
         /// <summary>
-        /// Creates a message that time (ms) below threshold value that is required to trigger a DO8 pin event.
+        /// Pulse count of DO3.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO8TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.DO8TimeBelowThreshold.FromPayload(messageType, GetPayload());
-        }
-    }
+        public byte Output3;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that time (ms) below threshold value that is required to trigger a DO8 pin event.
-    /// </summary>
-    [DisplayName("TimestampedDO8TimeBelowThresholdPayload")]
-    [Description("Creates a timestamped message payload that time (ms) below threshold value that is required to trigger a DO8 pin event.")]
-    public partial class CreateTimestampedDO8TimeBelowThresholdPayload : CreateDO8TimeBelowThresholdPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that time (ms) below threshold value that is required to trigger a DO8 pin event.
+        /// Pulse count of DO4.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO8TimeBelowThreshold register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.LoadCells.DO8TimeBelowThreshold.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public byte Output4;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that specifies the active events in the device.
-    /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that specifies the active events in the device.")]
-    public partial class CreateEnableEventsPayload
-    {
         /// <summary>
-        /// Gets or sets the value that specifies the active events in the device.
+        /// Pulse count of DO5.
         /// </summary>
-        [Description("The value that specifies the active events in the device.")]
-        public LoadCellEvents EnableEvents { get; set; }
+        public byte Output5;
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// Pulse count of DO6.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public LoadCellEvents GetPayload()
-        {
-            return EnableEvents;
-        }
+        public byte Output6;
 
         /// <summary>
-        /// Creates a message that specifies the active events in the device.
+        /// Pulse count of DO7.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.LoadCells.EnableEvents.FromPayload(messageType, GetPayload());
-        }
-    }
+        public byte Output7;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that specifies the active events in the device.
-    /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that specifies the active events in the device.
+        /// Pulse count of DO8.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        public byte Output8;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PulseCount register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PulseCount register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.LoadCells.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            return "PulseCountPayload { " +
+                "Output1 = " + Output1 + ", " +
+                "Output2 = " + Output2 + ", " +
+                "Output3 = " + Output3 + ", " +
+                "Output4 = " + Output4 + ", " +
+                "Output5 = " + Output5 + ", " +
+                "Output6 = " + Output6 + ", " +
+                "Output7 = " + Output7 + ", " +
+                "Output8 = " + Output8 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents the payload of the LoadCellData register.
+    /// Represents the payload of the DoScheduleStartTime register.
     /// </summary>
-    public struct LoadCellDataPayload
+    public struct DoScheduleStartTimePayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="LoadCellDataPayload"/> structure.
+        /// Initializes a new instance of the <see cref="DoScheduleStartTimePayload"/> structure.
         /// </summary>
-        /// <param name="channel0"></param>
-        /// <param name="channel1"></param>
-        /// <param name="channel2"></param>
-        /// <param name="channel3"></param>
-        /// <param name="channel4"></param>
-        /// <param name="channel5"></param>
-        /// <param name="channel6"></param>
-        /// <param name="channel7"></param>
-        public LoadCellDataPayload(
-            short channel0,
-            short channel1,
-            short channel2,
-            short channel3,
-            short channel4,
-            short channel5,
-            short channel6,
-            short channel7)
+        /// <param name="seconds">Seconds of the start time.</param>
+        /// <param name="microseconds">Microseconds of the start time, from 0 to 999999.</param>
+        public DoScheduleStartTimePayload(
+            uint seconds,
+            uint microseconds)
         {
-            Channel0 = channel0;
-            Channel1 = channel1;
-            Channel2 = channel2;
-            Channel3 = channel3;
-            Channel4 = channel4;
-            Channel5 = channel5;
-            Channel6 = channel6;
-            Channel7 = channel7;
+            Seconds = seconds;
+            Microseconds = microseconds;
         }
 
         /// <summary>
-        /// 
-        /// </summary>
-        public short Channel0;
-
-        /// <summary>
-        /// 
-        /// </summary>
-        public short Channel1;
-
-        /// <summary>
-        /// 
+        /// Seconds of the start time.
         /// </summary>
-        public short Channel2;
+        public uint Seconds;
 
         /// <summary>
-        /// 
+        /// Microseconds of the start time, from 0 to 999999.
         /// </summary>
-        public short Channel3;
+        public uint Microseconds;
 
         /// <summary>
-        /// 
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the DoScheduleStartTime register.
         /// </summary>
-        public short Channel4;
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// DoScheduleStartTime register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "DoScheduleStartTimePayload { " +
+                "Seconds = " + Seconds + ", " +
+                "Microseconds = " + Microseconds + " " +
+            "}";
+        }
+    }
 
+    /// <summary>
+    /// Represents the payload of the DigitalInputEdge register.
+    /// </summary>
+    public struct DigitalInputEdgePayload
+    {
         /// <summary>
-        /// 
+        /// Initializes a new instance of the <see cref="DigitalInputEdgePayload"/> structure.
         /// </summary>
-        public short Channel5;
+        /// <param name="state">State of the input after the edge.</param>
+        /// <param name="capture">Timer count at the edge, in steps of 0.25 us. It wraps every 16.384 ms, so the difference between two edges is exact to 0.25 us when they are closer than that.</param>
+        public DigitalInputEdgePayload(
+            ushort state,
+            ushort capture)
+        {
+            State = state;
+            Capture = capture;
+        }
 
         /// <summary>
-        /// 
+        /// State of the input after the edge.
         /// </summary>
-        public short Channel6;
+        public ushort State;
 
         /// <summary>
-        /// 
+        /// Timer count at the edge, in steps of 0.25 us. It wraps every 16.384 ms, so the difference between two edges is exact to 0.25 us when they are closer than that.
         /// </summary>
-        public short Channel7;
+        public ushort Capture;
 
         /// <summary>
         /// Returns a <see cref="string"/> that represents the payload of
-        /// the LoadCellData register.
+        /// the DigitalInputEdge register.
         /// </summary>
         /// <returns>
         /// A <see cref="string"/> that represents the payload of the
-        /// LoadCellData register.
+        /// DigitalInputEdge register.
         /// </returns>
         public override string ToString()
         {
-            return "LoadCellDataPayload { " +
-                "Channel0 = " + Channel0 + ", " +
-                "Channel1 = " + Channel1 + ", " +
-                "Channel2 = " + Channel2 + ", " +
-                "Channel3 = " + Channel3 + ", " +
-                "Channel4 = " + Channel4 + ", " +
-                "Channel5 = " + Channel5 + ", " +
-                "Channel6 = " + Channel6 + ", " +
-                "Channel7 = " + Channel7 + " " +
+            return "DigitalInputEdgePayload { " +
+                "State = " + State + ", " +
+                "Capture = " + Capture + " " +
             "}";
         }
     }
@@ -8967,7 +16327,50 @@ namespace Harp.LoadCells
         LoadCellData = 0x1,
         DigitalInput = 0x2,
         SyncOutput = 0x4,
-        Thresholds = 0x8
+        Thresholds = 0x8,
+        LoadCellDataBatch = 0x10,
+        LoadCellDataVirtual = 0x20,
+        DoSchedule = 0x40,
+        DigitalInputEdge = 0x80
+    }
+
+    /// <summary>
+    /// Available load cell reader ports.
+    /// </summary>
+    [Flags]
+    public enum LoadCellPorts : byte
+    {
+        None = 0x0,
+        Port0 = 0x1,
+        Port1 = 0x2
+    }
+
+    /// <summary>
+    /// Available consumers of the filtered channels.
+    /// </summary>
+    [Flags]
+    public enum FilterTargets : byte
+    {
+        None = 0x0,
+        Thresholds = 0x1,
+        LoadCellData = 0x2
+    }
+
+    /// <summary>
+    /// Available load cell channels.
+    /// </summary>
+    [Flags]
+    public enum LoadCellChannels : byte
+    {
+        None = 0x0,
+        Channel0 = 0x1,
+        Channel1 = 0x2,
+        Channel2 = 0x4,
+        Channel3 = 0x8,
+        Channel4 = 0x10,
+        Channel5 = 0x20,
+        Channel6 = 0x40,
+        Channel7 = 0x80
     }
 
     /// <summary>
@@ -9003,6 +16406,66 @@ namespace Harp.LoadCells
         Channel5 = 5,
         Channel6 = 6,
         Channel7 = 7,
-        None = 8
+        None = 8,
+        Virtual0 = 9,
+        Virtual1 = 10,
+        Virtual2 = 11,
+        Virtual3 = 12
+    }
+
+    /// <summary>
+    /// Available sample rates for the load cell channels.
+    /// </summary>
+    public enum SampleRateConfig : byte
+    {
+        SampleRate100Hz = 0,
+        SampleRate200Hz = 1,
+        SampleRate250Hz = 2,
+        SampleRate500Hz = 3,
+        SampleRate1000Hz = 4,
+        SampleRate2000Hz = 5
+    }
+
+    /// <summary>
+    /// Available number of samples averaged on the device before reporting the load cell channels.
+    /// </summary>
+    public enum DecimationConfig : byte
+    {
+        None = 0,
+        Average2 = 1,
+        Average4 = 2,
+        Average8 = 3,
+        Average16 = 4
+    }
+
+    /// <summary>
+    /// Available modes for evaluating the thresholds.
+    /// </summary>
+    public enum ThresholdsModeConfig : byte
+    {
+        Decimated = 0,
+        LowLatency = 1
+    }
+
+    /// <summary>
+    /// Available filters for the load cell channels.
+    /// </summary>
+    public enum FilterModeConfig : byte
+    {
+        None = 0,
+        Iir = 1,
+        MovingAverage = 2
+    }
+
+    /// <summary>
+    /// Available ways to start the digital output schedule.
+    /// </summary>
+    public enum ScheduleStartConfig : byte
+    {
+        Stop = 0,
+        Now = 1,
+        AtTime = 2,
+        DigitalInputRise = 3,
+        DigitalInputFall = 4
     }
 }
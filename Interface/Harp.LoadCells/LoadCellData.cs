@@ -0,0 +1,132 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.ComponentModel;
+using System.Reactive.Linq;
+
+namespace Harp.LoadCells
+{
+    public partial class LoadCellData
+    {
+        /// <summary>
+        /// Returns the number of channels in <see cref="LoadCellData"/> register messages
+        /// for the specified enabled ports.
+        /// </summary>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <returns>The number of channels in each message payload.</returns>
+        public static int GetPayloadLength(LoadCellPorts enabledPorts)
+        {
+            return enabledPorts == LoadCellPorts.Port0 || enabledPorts == LoadCellPorts.Port1 ? 4 : 8;
+        }
+
+        /// <summary>
+        /// Returns the number of elements in <see cref="LoadCellData"/> register messages
+        /// for the specified enabled ports and sequence setting.
+        /// </summary>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <param name="sequence">The value of the <see cref="EnableSequence"/> register.</param>
+        /// <returns>The number of elements in each message payload, including the sequence number.</returns>
+        public static int GetPayloadLength(LoadCellPorts enabledPorts, EnableFlag sequence)
+        {
+            return GetPayloadLength(enabledPorts) + (sequence == EnableFlag.Enable ? 1 : 0);
+        }
+
+        /// <summary>
+        /// Returns the sequence number of <see cref="LoadCellData"/> register messages
+        /// sent with <see cref="EnableSequence"/> set.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>The sequence number of the first sample averaged into the message.</returns>
+        public static ushort GetSequence(HarpMessage message)
+        {
+            var payload = message.GetPayloadArray<short>();
+            return (ushort)payload[payload.Length - 1];
+        }
+
+        internal static LoadCellDataPayload ParsePayload(short[] payload, int offset, LoadCellPorts enabledPorts)
+        {
+            var result = new LoadCellDataPayload();
+            switch (enabledPorts)
+            {
+                case LoadCellPorts.Port0:
+                    result.Channel0 = payload[offset + 0];
+                    result.Channel1 = payload[offset + 1];
+                    result.Channel2 = payload[offset + 2];
+                    result.Channel3 = payload[offset + 3];
+                    break;
+                case LoadCellPorts.Port1:
+                    result.Channel4 = payload[offset + 0];
+                    result.Channel5 = payload[offset + 1];
+                    result.Channel6 = payload[offset + 2];
+                    result.Channel7 = payload[offset + 3];
+                    break;
+                default:
+                    result.Channel0 = payload[offset + 0];
+                    result.Channel1 = payload[offset + 1];
+                    result.Channel2 = payload[offset + 2];
+                    result.Channel3 = payload[offset + 3];
+                    result.Channel4 = payload[offset + 4];
+                    result.Channel5 = payload[offset + 5];
+                    result.Channel6 = payload[offset + 6];
+                    result.Channel7 = payload[offset + 7];
+                    break;
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoadCellData"/> register messages
+        /// sent with the specified enabled ports.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <returns>A value representing the message payload. Channels of disabled ports are set to zero.</returns>
+        public static LoadCellDataPayload GetPayload(HarpMessage message, LoadCellPorts enabledPorts)
+        {
+            return ParsePayload(message.GetPayloadArray<short>(), 0, enabledPorts);
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoadCellData"/> register messages
+        /// sent with the specified enabled ports.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <returns>A value representing the timestamped message payload. Channels of disabled ports are set to zero.</returns>
+        public static Timestamped<LoadCellDataPayload> GetTimestampedPayload(HarpMessage message, LoadCellPorts enabledPorts)
+        {
+            var payload = message.GetTimestampedPayloadArray<short>();
+            return Timestamped.Create(ParsePayload(payload.Value, 0, enabledPorts), payload.Seconds);
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that parses <see cref="LoadCellData"/> events sent with
+    /// any combination of enabled ports.
+    /// </summary>
+    [Description("Parses LoadCellData events sent with any combination of enabled ports.")]
+    public class ParseLoadCellData : Combinator<HarpMessage, Timestamped<LoadCellDataPayload>>
+    {
+        /// <summary>
+        /// Gets or sets the ports enabled in the device.
+        /// </summary>
+        [Description("The ports enabled in the device.")]
+        public LoadCellPorts EnabledPorts { get; set; } = LoadCellPorts.Port0 | LoadCellPorts.Port1;
+
+        /// <summary>
+        /// Parses each <see cref="LoadCellData"/> event in an observable sequence.
+        /// </summary>
+        /// <param name="source">The sequence of Harp messages reported by the device.</param>
+        /// <returns>A sequence of timestamped load cell frames. Channels of disabled ports are set to zero.</returns>
+        public override IObservable<Timestamped<LoadCellDataPayload>> Process(IObservable<HarpMessage> source)
+        {
+            return Observable.Defer(() =>
+            {
+                var enabledPorts = EnabledPorts;
+                return source
+                    .Where(message => message.Address == LoadCellData.Address && message.MessageType == MessageType.Event)
+                    .Select(message => LoadCellData.GetTimestampedPayload(message, enabledPorts));
+            });
+        }
+    }
+}
@@ -0,0 +1,212 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.ComponentModel;
+using System.Reactive.Linq;
+
+namespace Harp.LoadCells
+{
+    public partial class LoadCellDataBatch
+    {
+        /// <summary>
+        /// Represents the maximum number of load cell channels in each frame of the
+        /// <see cref="LoadCellDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int FrameLength = 8;
+
+        static LoadCellDataPayload[] ParseFrames(short[] payload, LoadCellPorts enabledPorts, EnableFlag sequence)
+        {
+            var frameLength = LoadCellData.GetPayloadLength(enabledPorts, sequence);
+            var result = new LoadCellDataPayload[payload.Length / frameLength];
+            for (int i = 0; i < result.Length; i++)
+            {
+                result[i] = LoadCellData.ParsePayload(payload, i * frameLength, enabledPorts);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the individual frames packed in <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>An array with one <see cref="LoadCellDataPayload"/> value for each frame in the message.</returns>
+        public static LoadCellDataPayload[] GetFrames(HarpMessage message)
+        {
+            return GetFrames(message, LoadCellPorts.Port0 | LoadCellPorts.Port1);
+        }
+
+        /// <summary>
+        /// Returns the individual frames packed in <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <returns>
+        /// An array with one <see cref="LoadCellDataPayload"/> value for each frame in the message.
+        /// Channels of disabled ports are set to zero.
+        /// </returns>
+        public static LoadCellDataPayload[] GetFrames(HarpMessage message, LoadCellPorts enabledPorts)
+        {
+            return GetFrames(message, enabledPorts, EnableFlag.Disable);
+        }
+
+        /// <summary>
+        /// Returns the individual frames packed in <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <param name="sequence">The value of the <see cref="EnableSequence"/> register.</param>
+        /// <returns>
+        /// An array with one <see cref="LoadCellDataPayload"/> value for each frame in the message.
+        /// Channels of disabled ports are set to zero.
+        /// </returns>
+        public static LoadCellDataPayload[] GetFrames(HarpMessage message, LoadCellPorts enabledPorts, EnableFlag sequence)
+        {
+            return ParseFrames(message.GetPayloadArray<short>(), enabledPorts, sequence);
+        }
+
+        /// <summary>
+        /// Returns the sequence numbers of the frames packed in <see cref="LoadCellDataBatch"/> register
+        /// messages sent with <see cref="EnableSequence"/> set.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <returns>An array with the sequence number of each frame in the message.</returns>
+        public static ushort[] GetSequences(HarpMessage message, LoadCellPorts enabledPorts)
+        {
+            var payload = message.GetPayloadArray<short>();
+            var frameLength = LoadCellData.GetPayloadLength(enabledPorts, EnableFlag.Enable);
+            var result = new ushort[payload.Length / frameLength];
+            for (int i = 0; i < result.Length; i++)
+            {
+                result[i] = (ushort)payload[i * frameLength + frameLength - 1];
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the individual timestamped frames packed in <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="samplePeriod">The time between consecutive frames, in seconds.</param>
+        /// <returns>
+        /// An array with one timestamped <see cref="LoadCellDataPayload"/> value for each frame in the message.
+        /// The first frame has the timestamp of the message.
+        /// </returns>
+        public static Timestamped<LoadCellDataPayload>[] GetTimestampedFrames(HarpMessage message, double samplePeriod)
+        {
+            return GetTimestampedFrames(message, samplePeriod, LoadCellPorts.Port0 | LoadCellPorts.Port1);
+        }
+
+        /// <summary>
+        /// Returns the individual timestamped frames packed in <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="samplePeriod">The time between consecutive frames, in seconds.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <returns>
+        /// An array with one timestamped <see cref="LoadCellDataPayload"/> value for each frame in the message.
+        /// The first frame has the timestamp of the message. Channels of disabled ports are set to zero.
+        /// </returns>
+        public static Timestamped<LoadCellDataPayload>[] GetTimestampedFrames(HarpMessage message, double samplePeriod, LoadCellPorts enabledPorts)
+        {
+            return GetTimestampedFrames(message, samplePeriod, enabledPorts, EnableFlag.Disable);
+        }
+
+        /// <summary>
+        /// Returns the individual timestamped frames packed in <see cref="LoadCellDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="samplePeriod">The time between consecutive frames, in seconds.</param>
+        /// <param name="enabledPorts">The value of the <see cref="EnablePorts"/> register.</param>
+        /// <param name="sequence">The value of the <see cref="EnableSequence"/> register.</param>
+        /// <returns>
+        /// An array with one timestamped <see cref="LoadCellDataPayload"/> value for each frame in the message.
+        /// The first frame has the timestamp of the message. Channels of disabled ports are set to zero.
+        /// </returns>
+        public static Timestamped<LoadCellDataPayload>[] GetTimestampedFrames(HarpMessage message, double samplePeriod, LoadCellPorts enabledPorts, EnableFlag sequence)
+        {
+            var payload = message.GetTimestampedPayloadArray<short>();
+            var frames = ParseFrames(payload.Value, enabledPorts, sequence);
+            var result = new Timestamped<LoadCellDataPayload>[frames.Length];
+            for (int i = 0; i < frames.Length; i++)
+            {
+                result[i] = Timestamped.Create(frames[i], payload.Seconds + i * samplePeriod);
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the time between consecutive frames for the specified device configuration.
+        /// </summary>
+        /// <param name="sampleRate">The value of the <see cref="SampleRate"/> register.</param>
+        /// <param name="decimation">The value of the <see cref="Decimation"/> register.</param>
+        /// <returns>The time between consecutive frames, in seconds.</returns>
+        public static double GetSamplePeriod(SampleRateConfig sampleRate, DecimationConfig decimation)
+        {
+            double frequency;
+            switch (sampleRate)
+            {
+                case SampleRateConfig.SampleRate100Hz: frequency = 100; break;
+                case SampleRateConfig.SampleRate200Hz: frequency = 200; break;
+                case SampleRateConfig.SampleRate250Hz: frequency = 250; break;
+                case SampleRateConfig.SampleRate500Hz: frequency = 500; break;
+                case SampleRateConfig.SampleRate1000Hz: frequency = 1000; break;
+                case SampleRateConfig.SampleRate2000Hz: frequency = 2000; break;
+                default: throw new ArgumentOutOfRangeException(nameof(sampleRate));
+            }
+
+            return (1 << (int)decimation) / frequency;
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that splits <see cref="LoadCellDataBatch"/> events into
+    /// a sequence of timestamped load cell frames, one for each sample.
+    /// </summary>
+    [Description("Splits LoadCellDataBatch events into a sequence of timestamped load cell frames.")]
+    public class ParseLoadCellDataBatch : Combinator<HarpMessage, Timestamped<LoadCellDataPayload>>
+    {
+        /// <summary>
+        /// Gets or sets the sample rate configured in the device.
+        /// </summary>
+        [Description("The sample rate configured in the device.")]
+        public SampleRateConfig SampleRate { get; set; } = SampleRateConfig.SampleRate1000Hz;
+
+        /// <summary>
+        /// Gets or sets the decimation configured in the device.
+        /// </summary>
+        [Description("The decimation configured in the device.")]
+        public DecimationConfig Decimation { get; set; } = DecimationConfig.None;
+
+        /// <summary>
+        /// Gets or sets the ports enabled in the device.
+        /// </summary>
+        [Description("The ports enabled in the device.")]
+        public LoadCellPorts EnabledPorts { get; set; } = LoadCellPorts.Port0 | LoadCellPorts.Port1;
+
+        /// <summary>
+        /// Gets or sets a value specifying whether the frames end with the sequence number.
+        /// </summary>
+        [Description("Specifies whether the frames end with the sequence number.")]
+        public EnableFlag Sequence { get; set; } = EnableFlag.Disable;
+
+        /// <summary>
+        /// Splits each <see cref="LoadCellDataBatch"/> event in an observable sequence
+        /// into its individual timestamped frames.
+        /// </summary>
+        /// <param name="source">The sequence of Harp messages reported by the device.</param>
+        /// <returns>A sequence of timestamped load cell frames, in acquisition order.</returns>
+        public override IObservable<Timestamped<LoadCellDataPayload>> Process(IObservable<HarpMessage> source)
+        {
+            return Observable.Defer(() =>
+            {
+                var samplePeriod = LoadCellDataBatch.GetSamplePeriod(SampleRate, Decimation);
+                var enabledPorts = EnabledPorts;
+                var sequence = Sequence;
+                return source
+                    .Where(message => message.Address == LoadCellDataBatch.Address && message.MessageType == MessageType.Event)
+                    .SelectMany(message => LoadCellDataBatch.GetTimestampedFrames(message, samplePeriod, enabledPorts, sequence));
+            });
+        }
+    }
+}
@@ -0,0 +1,89 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.ComponentModel;
+using System.Linq;
+using System.Reactive.Linq;
+
+namespace Harp.LoadCells
+{
+    /// <summary>
+    /// Represents an operator that rebuilds the load cell frames from <see cref="LoadCellData"/>
+    /// keyframes and the <see cref="LoadCellDataDelta"/> events sent between them.
+    /// </summary>
+    [Description("Rebuilds the load cell frames from LoadCellData keyframes and LoadCellDataDelta events.")]
+    public class DecodeLoadCellData : Combinator<HarpMessage, Timestamped<LoadCellDataPayload>>
+    {
+        /// <summary>
+        /// Gets or sets the ports enabled in the device.
+        /// </summary>
+        [Description("The ports enabled in the device.")]
+        public LoadCellPorts EnabledPorts { get; set; } = LoadCellPorts.Port0 | LoadCellPorts.Port1;
+
+        /// <summary>
+        /// Gets or sets a value specifying whether the frames end with the sequence number.
+        /// When enabled, the deltas that follow a lost frame are skipped until the next keyframe.
+        /// </summary>
+        [Description("Specifies whether the frames end with the sequence number. When enabled, the deltas that follow a lost frame are skipped until the next keyframe.")]
+        public EnableFlag Sequence { get; set; } = EnableFlag.Disable;
+
+        /// <summary>
+        /// Gets or sets the decimation configured in the device.
+        /// </summary>
+        [Description("The decimation configured in the device.")]
+        public DecimationConfig Decimation { get; set; } = DecimationConfig.None;
+
+        /// <summary>
+        /// Rebuilds the full load cell frames from an observable sequence of
+        /// <see cref="LoadCellData"/> and <see cref="LoadCellDataDelta"/> events.
+        /// </summary>
+        /// <param name="source">The sequence of Harp messages reported by the device.</param>
+        /// <returns>A sequence of timestamped load cell frames. Channels of disabled ports are set to zero.</returns>
+        public override IObservable<Timestamped<LoadCellDataPayload>> Process(IObservable<HarpMessage> source)
+        {
+            return Observable.Defer(() =>
+            {
+                var enabledPorts = EnabledPorts;
+                var hasSequence = Sequence == EnableFlag.Enable;
+                var step = 1 << (int)Decimation;
+                var channels = LoadCellData.GetPayloadLength(enabledPorts);
+                var reference = new short[channels];
+                var referenceIsValid = false;
+                var sequence = default(ushort);
+
+                return source
+                    .Where(message => message.MessageType == MessageType.Event &&
+                                      (message.Address == LoadCellData.Address || message.Address == LoadCellDataDelta.Address))
+                    .SelectMany(message =>
+                    {
+                        if (message.Address == LoadCellData.Address)
+                        {
+                            var keyframe = message.GetTimestampedPayloadArray<short>();
+                            Array.Copy(keyframe.Value, reference, channels);
+                            if (hasSequence) sequence = (ushort)keyframe.Value[channels];
+                            referenceIsValid = true;
+                            return new[] { Timestamped.Create(LoadCellData.ParsePayload(reference, 0, enabledPorts), keyframe.Seconds) };
+                        }
+
+                        var delta = message.GetTimestampedPayloadArray<sbyte>();
+                        if (hasSequence)
+                        {
+                            sequence += (ushort)step;
+                            referenceIsValid &= (byte)delta.Value[channels] == (byte)sequence;
+                        }
+
+                        if (!referenceIsValid)
+                        {
+                            return Enumerable.Empty<Timestamped<LoadCellDataPayload>>();
+                        }
+
+                        for (int i = 0; i < channels; i++)
+                        {
+                            reference[i] += delta.Value[i];
+                        }
+                        return new[] { Timestamped.Create(LoadCellData.ParsePayload(reference, 0, enabledPorts), delta.Seconds) };
+                    });
+            });
+        }
+    }
+}
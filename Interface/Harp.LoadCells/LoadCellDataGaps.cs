@@ -0,0 +1,111 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.Collections.Generic;
+using System.ComponentModel;
+using System.Reactive.Linq;
+
+namespace Harp.LoadCells
+{
+    /// <summary>
+    /// Represents samples lost between two consecutive load cell frames.
+    /// </summary>
+    public struct LoadCellDataGap
+    {
+        /// <summary>
+        /// The timestamp of the message with the first frame after the gap.
+        /// </summary>
+        public double Seconds;
+
+        /// <summary>
+        /// The sequence number of the last frame received before the gap.
+        /// </summary>
+        public ushort PreviousSequence;
+
+        /// <summary>
+        /// The sequence number of the first frame received after the gap.
+        /// </summary>
+        public ushort Sequence;
+
+        /// <summary>
+        /// The number of conversions lost. With decimation, a lost frame counts
+        /// as all the samples averaged into it.
+        /// </summary>
+        public int LostSamples;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the gap.
+        /// </summary>
+        /// <returns>A <see cref="string"/> that represents the gap.</returns>
+        public override string ToString()
+        {
+            return "LoadCellDataGap { " +
+                "Seconds = " + Seconds + ", " +
+                "PreviousSequence = " + PreviousSequence + ", " +
+                "Sequence = " + Sequence + ", " +
+                "LostSamples = " + LostSamples + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that reports the samples lost between <see cref="LoadCellData"/>
+    /// or <see cref="LoadCellDataBatch"/> events sent with <see cref="EnableSequence"/> set.
+    /// </summary>
+    [Description("Reports the samples lost between LoadCellData or LoadCellDataBatch events sent with EnableSequence set.")]
+    public class DetectLoadCellDataGaps : Combinator<HarpMessage, LoadCellDataGap>
+    {
+        /// <summary>
+        /// Gets or sets the decimation configured in the device.
+        /// </summary>
+        [Description("The decimation configured in the device.")]
+        public DecimationConfig Decimation { get; set; } = DecimationConfig.None;
+
+        /// <summary>
+        /// Gets or sets the ports enabled in the device.
+        /// </summary>
+        [Description("The ports enabled in the device.")]
+        public LoadCellPorts EnabledPorts { get; set; } = LoadCellPorts.Port0 | LoadCellPorts.Port1;
+
+        /// <summary>
+        /// Compares the sequence numbers of consecutive frames in an observable sequence
+        /// of <see cref="LoadCellData"/> or <see cref="LoadCellDataBatch"/> events.
+        /// </summary>
+        /// <param name="source">The sequence of Harp messages reported by the device.</param>
+        /// <returns>A sequence with one value for each gap found.</returns>
+        public override IObservable<LoadCellDataGap> Process(IObservable<HarpMessage> source)
+        {
+            return Observable.Defer(() =>
+            {
+                var step = 1 << (int)Decimation;
+                var enabledPorts = EnabledPorts;
+                var previous = default(ushort?);
+                return source
+                    .Where(message => message.MessageType == MessageType.Event &&
+                                      (message.Address == LoadCellData.Address || message.Address == LoadCellDataBatch.Address))
+                    .SelectMany(message =>
+                    {
+                        var sequences = message.Address == LoadCellData.Address
+                            ? new[] { LoadCellData.GetSequence(message) }
+                            : LoadCellDataBatch.GetSequences(message, enabledPorts);
+
+                        var gaps = new List<LoadCellDataGap>();
+                        foreach (var sequence in sequences)
+                        {
+                            if (previous.HasValue && sequence != (ushort)(previous.Value + step))
+                            {
+                                LoadCellDataGap gap;
+                                gap.Seconds = message.GetTimestamp();
+                                gap.PreviousSequence = previous.Value;
+                                gap.Sequence = sequence;
+                                gap.LostSamples = (ushort)(sequence - previous.Value) - step;
+                                gaps.Add(gap);
+                            }
+                            previous = sequence;
+                        }
+                        return gaps;
+                    });
+            });
+        }
+    }
+}